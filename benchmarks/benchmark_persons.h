@@ -0,0 +1,67 @@
+#pragma once
+
+#include <sqlite3.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "uss.h"
+
+// ============================================================================
+// Shared Person fixtures for the benchmarks
+// ============================================================================
+
+inline Person personRowMapper(sqlite3_stmt* stmt) {
+    Person person;
+    person.id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    person.email = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+    person.passwordHash = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+    person.status = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+    return person;
+}
+
+inline void personBinder(sqlite3_stmt* stmt, const Person& person) {
+    sqlite3_bind_text(stmt, 1, person.id.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_text(stmt, 2, person.email.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_text(stmt, 3, person.passwordHash.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_text(stmt, 4, person.status.c_str(), -1, SQLITE_TRANSIENT);
+}
+
+inline Person makePerson(int64_t i) {
+    const auto n = std::to_string(i);
+    return {"id-" + n, "user" + n + "@example.com", "hash" + n, "active"};
+}
+
+inline std::vector<Person> makePersons(int64_t count) {
+    std::vector<Person> persons;
+    persons.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; i++) {
+        persons.push_back(makePerson(i));
+    }
+    return persons;
+}
+
+// Opens path (":memory:" or a file, which is recreated) with an empty persons table
+inline sqlite3* openPersonsDb(const std::string& path) {
+    if (path != ":memory:") {
+        std::remove(path.c_str());
+    }
+    sqlite3* db = nullptr;
+    sqlite3_open(path.c_str(), &db);
+    sqlite3_exec(db, R"(
+        CREATE TABLE persons (
+            id TEXT PRIMARY KEY,
+            email TEXT NOT NULL,
+            passwordHash TEXT NOT NULL,
+            status TEXT NOT NULL
+        );
+    )", nullptr, nullptr, nullptr);
+    return db;
+}
+
+inline void closePersonsDb(sqlite3* db, const std::string& path) {
+    sqlite3_close(db);
+    if (path != ":memory:") {
+        std::remove(path.c_str());
+    }
+}
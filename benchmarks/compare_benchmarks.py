@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Compare google/benchmark JSON results against a stored baseline.
+
+Usage: compare_benchmarks.py BASELINE CURRENT [--threshold PERCENT]
+
+BASELINE and CURRENT are either JSON files written with
+--benchmark_out_format=json or directories of them; files are matched by
+name. A benchmark whose real time grew by more than PERCENT (default 10) is
+reported as a regression and makes the exit status 1.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+from pathlib import Path
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_file(path):
+    """Maps each benchmark name to its real time in nanoseconds.
+
+    With --benchmark_repetitions the median aggregate is used; BigO and RMS
+    entries of complexity fits have no real time and are skipped.
+    """
+    with open(path) as f:
+        entries = json.load(f).get("benchmarks", [])
+    runs = {}
+    medians = {}
+    for entry in entries:
+        if "real_time" not in entry:
+            continue
+        time = entry["real_time"] * NANOSECONDS[entry.get("time_unit", "ns")]
+        name = entry.get("run_name", entry["name"])
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = time
+        else:
+            runs.setdefault(name, []).append(time)
+    results = {name: statistics.median(times) for name, times in runs.items()}
+    results.update(medians)
+    return results
+
+
+def load(path):
+    """Maps (file name, benchmark name) to real time for a file or directory."""
+    path = Path(path)
+    if not path.exists():
+        return {}
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    results = {}
+    for file in files:
+        for name, time in load_file(file).items():
+            results[(file.stem, name)] = time
+    return results
+
+
+def format_time(ns):
+    for unit in ("s", "ms", "us"):
+        if ns >= NANOSECONDS[unit]:
+            return f"{ns / NANOSECONDS[unit]:.3g} {unit}"
+    return f"{ns:.3g} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent reported as a regression (default 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    if not baseline:
+        print(f"No baseline results in {args.baseline}; record them with the benchmarks_baseline target",
+              file=sys.stderr)
+        return 2
+
+    regressions = 0
+    width = max(len(name) for _, name in baseline.keys() | current.keys())
+    for key in sorted(baseline.keys() | current.keys()):
+        file, name = key
+        if key not in current:
+            print(f"{name:<{width}}  missing from current results ({file})")
+            continue
+        if key not in baseline:
+            print(f"{name:<{width}}  new: {format_time(current[key])}")
+            continue
+        before = baseline[key]
+        after = current[key]
+        change = (after - before) / before * 100 if before > 0 else 0.0
+        status = ""
+        if change > args.threshold:
+            status = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            status = "  improved"
+        print(f"{name:<{width}}  {format_time(before):>10} -> {format_time(after):>10}  {change:+7.1f}%{status}")
+
+    print(f"\n{regressions} regression(s) above {args.threshold:g}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include "credentials_batch.h"
+#include "uss.h"
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Credentials validation - exceptions vs ValidationResult, 90% invalid input
+// ============================================================================
+
+namespace {
+
+// Nine rejected requests for every accepted one, like a credential-stuffing flood
+const std::vector<Credentials>& requests() {
+    static const std::vector<Credentials> inputs = [] {
+        const std::vector<std::string> invalidEmails = {
+            "not-an-email", "missing@tld", "bad chars@example.com", "@example.com",
+            "a@b.c", "double@@example.com", "trailing@example.com.", "user@exa_mple.com",
+            "no.at.sign.example.com",
+        };
+        std::vector<Credentials> result;
+        for (size_t i = 0; i < 1000; i++) {
+            if (i % 10 == 0) {
+                result.emplace_back("  User" + std::to_string(i) + "@Example.COM  ", "Passw0rd.123");
+            } else {
+                result.emplace_back(invalidEmails[i % invalidEmails.size()], "Passw0rd.123");
+            }
+        }
+        return result;
+    }();
+    return inputs;
+}
+
+}
+
+static void BM_ThrowingValidation(benchmark::State& state) {
+    const auto& inputs = requests();
+    size_t i = 0;
+    int64_t rejected = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(sanitizeAndValidateCredentials(inputs[i++ % inputs.size()]));
+        } catch (const ValidationException& e) {
+            rejected += static_cast<int64_t>(e.getErrors().size());
+        }
+    }
+    benchmark::DoNotOptimize(rejected);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThrowingValidation);
+
+static void BM_ResultValidation(benchmark::State& state) {
+    const auto& inputs = requests();
+    size_t i = 0;
+    int64_t rejected = 0;
+    for (auto _ : state) {
+        auto result = validateCredentials(inputs[i++ % inputs.size()]);
+        rejected += static_cast<int64_t>(result.errors().size());
+        benchmark::DoNotOptimize(result);
+    }
+    benchmark::DoNotOptimize(rejected);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ResultValidation);
+
+// Each request copied into a stack arena first, so the result and its
+// errors never touch the heap
+static void BM_ResultValidationWithArena(benchmark::State& state) {
+    const auto& inputs = requests();
+    std::array<std::byte, 1024> buffer;
+    size_t i = 0;
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        Credentials request(inputs[i++ % inputs.size()], &arena);
+        auto result = validateCredentials(request);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ResultValidationWithArena);
+
+// ============================================================================
+// Batches of 1000 - per-item calls vs validateBatch
+// ============================================================================
+
+static void BM_PerItemValidation(benchmark::State& state) {
+    const auto& inputs = requests();
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            auto result = validateCredentials(input);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+BENCHMARK(BM_PerItemValidation);
+
+static void BM_ValidateBatch(benchmark::State& state) {
+    const auto& inputs = requests();
+    CredentialsBatchResult result;
+    for (auto _ : state) {
+        validateBatch(inputs, result);
+        benchmark::DoNotOptimize(result.value(0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+BENCHMARK(BM_ValidateBatch);
+
+static void BM_ValidateBatchOnThreadPool(benchmark::State& state) {
+    const auto& inputs = requests();
+    ThreadPool pool(static_cast<size_t>(state.range(0)), 64);
+    CredentialsBatchResult result;
+    for (auto _ : state) {
+        validateBatch(inputs, result, &pool, 128);
+        benchmark::DoNotOptimize(result.value(0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+BENCHMARK(BM_ValidateBatchOnThreadPool)->Arg(2)->Arg(4)->UseRealTime();
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include "uss.h"
+#include <algorithm>
+#include <cctype>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Email sanitizing and validation - state machine vs std::regex
+// ============================================================================
+
+namespace {
+
+const std::vector<std::string>& emails() {
+    static const std::vector<std::string> inputs = {
+        "alice@example.com",
+        "  Bob.Smith@Example.COM  ",
+        "first_last+newsletter@mail-server.example.org",
+        "USER-123@TEST.COM",
+        "a.very.long.local.part.with.many.dots@subdomain.department.example.co.uk",
+        "not-an-email",
+        "missing@tld",
+        "bad chars@example.com",
+    };
+    return inputs;
+}
+
+// Baseline: the previous trim and lowercase copies followed by a regex match
+std::string regexSanitizeAndValidateEmail(const std::string& email) {
+    static const std::regex grammar(R"([a-z0-9._%+-]+@[a-z0-9-]+(\.[a-z0-9-]+)+)");
+    std::string trimmed = email;
+    trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r\f\v"));
+    trimmed.erase(trimmed.find_last_not_of(" \t\n\r\f\v") + 1);
+    std::string sanitized = trimmed;
+    std::transform(sanitized.begin(), sanitized.end(), sanitized.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    if (sanitized.size() < 6 || !std::regex_match(sanitized, grammar)) {
+        throw std::invalid_argument("Invalid email");
+    }
+    return sanitized;
+}
+
+}
+
+static void BM_RegexEmailValidation(benchmark::State& state) {
+    const auto& inputs = emails();
+    size_t i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(regexSanitizeAndValidateEmail(inputs[i++ % inputs.size()]));
+        } catch (const std::invalid_argument&) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegexEmailValidation);
+
+static void BM_StateMachineEmailValidation(benchmark::State& state) {
+    const auto& inputs = emails();
+    size_t i = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(sanitizeAndValidateEmail(inputs[i++ % inputs.size()]));
+        } catch (const std::invalid_argument&) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateMachineEmailValidation);
+
+// Valid inputs only, so no exceptions are in the measurement
+static void BM_StateMachineValidEmails(benchmark::State& state) {
+    const auto& inputs = emails();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sanitizeAndValidateEmail(inputs[i++ % 5]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StateMachineValidEmails);
+
+static void BM_RegexValidEmails(benchmark::State& state) {
+    const auto& inputs = emails();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(regexSanitizeAndValidateEmail(inputs[i++ % 5]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegexValidEmails);
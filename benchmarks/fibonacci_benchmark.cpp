@@ -0,0 +1,240 @@
+#include <benchmark/benchmark.h>
+#include "fibonacci.h"
+#include "fibonacci_range.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Fibonacci::calc - naive recursive, iterative, table and fast doubling
+// ============================================================================
+
+namespace {
+
+int64_t naiveRecursive(int n) {
+    return n < 2 ? n : naiveRecursive(n - 1) + naiveRecursive(n - 2);
+}
+
+int64_t iterative(int n) {
+    int64_t a = 0;
+    int64_t b = 1;
+    for (int i = 0; i < n; i++) {
+        const int64_t next = a + b;
+        a = b;
+        b = next;
+    }
+    return a;
+}
+
+// The index is read through DoNotOptimize so the table lookup can't be folded
+int indexFor(benchmark::State& state) {
+    int index = static_cast<int>(state.range(0));
+    benchmark::DoNotOptimize(index);
+    return index;
+}
+
+}
+
+static void BM_FibonacciNaiveRecursive(benchmark::State& state) {
+    const int index = indexFor(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(naiveRecursive(index));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FibonacciNaiveRecursive)->Arg(10)->Arg(20)->Arg(30);
+
+static void BM_FibonacciIterative(benchmark::State& state) {
+    const int index = indexFor(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(iterative(index));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FibonacciIterative)->Arg(10)->Arg(30)->Arg(92);
+
+static void BM_FibonacciTable(benchmark::State& state) {
+    Fibonacci fib;
+    const int index = indexFor(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fib.calc(index));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FibonacciTable)->Arg(10)->Arg(30)->Arg(92);
+
+// F(n) mod (2^64 - 1) is exact up to index 93
+static void BM_FibonacciDoubling(benchmark::State& state) {
+    Fibonacci fib;
+    const int index = indexFor(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fib.calcMod(static_cast<uint64_t>(index), UINT64_MAX));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FibonacciDoubling)->Arg(10)->Arg(30)->Arg(92);
+
+static void BM_FibonacciDoublingModHugeIndex(benchmark::State& state) {
+    Fibonacci fib;
+    uint64_t index = 1000000000000000000ULL;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fib.calcMod(index++, 1000000007));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FibonacciDoublingModHugeIndex);
+
+// ============================================================================
+// Arbitrary precision - scaling over growing n
+// ============================================================================
+
+// Complexity() fits the time against n; fast doubling with Karatsuba should
+// come out well below the quadratic growth of the schoolbook runs
+static void BM_FibonacciCalcBig(benchmark::State& state) {
+    Fibonacci fib;
+    const auto index = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fib.calcBig(index));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_FibonacciCalcBig)->RangeMultiplier(4)->Range(1 << 12, 1 << 22)
+    ->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_FibonacciCalcBigToString(benchmark::State& state) {
+    Fibonacci fib;
+    const auto value = fib.calcBig(static_cast<uint64_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value.toString());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_FibonacciCalcBigToString)->RangeMultiplier(4)->Range(1 << 12, 1 << 22)
+    ->Unit(benchmark::kMillisecond)->Complexity();
+
+// Arg 0 is the operand size in limbs
+static void BM_BigMultiplyKaratsuba(benchmark::State& state) {
+    const auto a = Fibonacci().calcBig(static_cast<uint64_t>(state.range(0)) * 92);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * a);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BigMultiplyKaratsuba)->RangeMultiplier(4)->Range(16, 16384)->Complexity();
+
+static void BM_BigMultiplySchoolbook(benchmark::State& state) {
+    const auto a = Fibonacci().calcBig(static_cast<uint64_t>(state.range(0)) * 92);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BigUnsigned::multiplySchoolbook(a, a));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BigMultiplySchoolbook)->RangeMultiplier(4)->Range(16, 16384)->Complexity(benchmark::oNSquared);
+
+// ============================================================================
+// Modular batches - calcMod per index vs calcModBatch vs a Pisano table
+// ============================================================================
+
+namespace {
+
+std::vector<uint64_t> randomIndices(size_t count) {
+    std::vector<uint64_t> indices(count);
+    uint64_t x = 88172645463325252ULL;
+    for (auto& index : indices) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        index = x;
+    }
+    return indices;
+}
+
+constexpr size_t batchSize = 1 << 14;
+
+}
+
+// Arg 0 is the modulus
+static void BM_FibonacciCalcModLoop(benchmark::State& state) {
+    Fibonacci fib;
+    const auto indices = randomIndices(batchSize);
+    const auto modulus = static_cast<uint64_t>(state.range(0));
+    std::vector<uint64_t> out(batchSize);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batchSize; i++) {
+            out[i] = fib.calcMod(indices[i], modulus);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_FibonacciCalcModLoop)->Arg(1000)->Arg(1000000007)->Arg(1000000000000000000LL);
+
+static void BM_FibonacciCalcModBatch(benchmark::State& state) {
+    Fibonacci fib;
+    const auto indices = randomIndices(batchSize);
+    const auto modulus = static_cast<uint64_t>(state.range(0));
+    std::vector<uint64_t> out(batchSize);
+    for (auto _ : state) {
+        fib.calcModBatch(indices.data(), indices.size(), modulus, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_FibonacciCalcModBatch)->Arg(1000)->Arg(1000000007)->Arg(1000000000000000000LL);
+
+static void BM_FibonacciCalcModBatchPisano(benchmark::State& state) {
+    Fibonacci fib;
+    PisanoCache cache;
+    const auto indices = randomIndices(batchSize);
+    const auto modulus = static_cast<uint64_t>(state.range(0));
+    std::vector<uint64_t> out(batchSize);
+    for (auto _ : state) {
+        fib.calcModBatch(indices.data(), indices.size(), modulus, out.data(), &cache);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_FibonacciCalcModBatchPisano)->Arg(1000)->Arg(65521);
+
+// ============================================================================
+// Ranges - calcMod per index vs the recurrence over 1 to N threads
+// ============================================================================
+
+namespace {
+
+constexpr size_t rangeSize = 1 << 22;
+constexpr uint64_t rangeFirst = 1000000000000ULL;
+
+}
+
+static void BM_FibonacciRangeCalcModLoop(benchmark::State& state) {
+    Fibonacci fib;
+    std::vector<uint64_t> out(rangeSize / 64);
+    for (auto _ : state) {
+        for (size_t i = 0; i < out.size(); i++) {
+            out[i] = fib.calcMod(rangeFirst + i, 1000000007);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_FibonacciRangeCalcModLoop)->Unit(benchmark::kMillisecond);
+
+// Arg 0 is the number of threads filling the range, the caller included
+static void BM_FibonacciRange(benchmark::State& state) {
+    const auto threads = static_cast<size_t>(state.range(0));
+    std::unique_ptr<ThreadPool> pool;
+    if (threads > 1) {
+        pool = std::make_unique<ThreadPool>(threads - 1, threads);
+    }
+    std::vector<uint64_t> out(rangeSize);
+    for (auto _ : state) {
+        fibonacciModRange(rangeFirst, out.size(), 1000000007, out.data(), pool.get());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_FibonacciRange)->DenseRange(1, std::max(2u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "login_service.h"
+#include "repository.h"
+#include <sqlite3.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// LoginService::login latency - p50/p99 per repository backend
+// ============================================================================
+
+namespace {
+
+const int64_t userCount = 10000;
+const std::string password = "Passw0rd.123";
+
+// Arg 0 is the PBKDF2 iteration count. Every user shares one hash, which
+// keeps setup fast and doesn't change the cost of a login.
+std::vector<Person> usersWithHash(const std::string& hash) {
+    auto persons = makePersons(userCount);
+    for (auto& person : persons) {
+        person.passwordHash = hash;
+    }
+    return persons;
+}
+
+Credentials credentialsFor(int64_t i) {
+    return {"  User" + std::to_string((i * 7919) % userCount) + "@Example.com ", password};
+}
+
+// Times each login and reports the median and the 99th percentile
+void runLogins(benchmark::State& state, LoginService& service) {
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(state.max_iterations));
+    int64_t i = 0;
+    for (auto _ : state) {
+        const auto credentials = credentialsFor(i++);
+        const auto start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(service.login(credentials));
+        latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_us"] = latencies[latencies.size() / 2];
+    state.counters["p99_us"] = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+    state.SetItemsProcessed(state.iterations());
+}
+
+std::shared_ptr<PasswordHasher> hasherFor(const benchmark::State& state) {
+    return std::make_shared<Pbkdf2PasswordHasher>(static_cast<uint32_t>(state.range(0)));
+}
+
+}
+
+static void BM_LoginVectorRepository(benchmark::State& state) {
+    auto hasher = hasherFor(state);
+    auto repository = std::make_shared<VectorRepository<Person>>(
+        [](const Person& person, const std::string& email) { return std::string_view(person.email) == email; },
+        usersWithHash(hasher->hash(password)));
+    LoginService service(repository, hasher, std::make_shared<UuidGeneratorSecureV4<>>());
+    runLogins(state, service);
+}
+BENCHMARK(BM_LoginVectorRepository)->Arg(1)->Arg(1000)->Arg(10000);
+
+static void BM_LoginSqliteRepository(benchmark::State& state) {
+    auto hasher = hasherFor(state);
+    sqlite3* db = openPersonsDb(":memory:");
+    sqlite3_exec(db, "CREATE INDEX persons_email ON persons (email)", nullptr, nullptr, nullptr);
+    auto repository = std::make_shared<SqliteRepository<Person>>(db, "persons", personRowMapper, "email");
+    repository->insertMany(usersWithHash(hasher->hash(password)), personBinder);
+    {
+        LoginService service(repository, hasher, std::make_shared<UuidGeneratorSecureV4<>>());
+        runLogins(state, service);
+    }
+    repository.reset();
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_LoginSqliteRepository)->Arg(1)->Arg(1000)->Arg(10000);
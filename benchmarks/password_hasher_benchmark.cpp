@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include "password_hasher.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// PBKDF2-HMAC-SHA256 - hashes per second per core at several costs
+// ============================================================================
+
+// One thread, so items_per_second is hashes per second per core
+static void BM_Pbkdf2Verify(benchmark::State& state) {
+    Pbkdf2PasswordHasher hasher(static_cast<uint32_t>(state.range(0)));
+    const auto encoded = hasher.hash("Passw0rd.123");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher.verify("Passw0rd.123", encoded));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["iterations_per_second"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * static_cast<double>(state.range(0)), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_Pbkdf2Verify)->Arg(1000)->Arg(10000)->Arg(100000)->Arg(Pbkdf2PasswordHasher::defaultIterations)
+    ->Unit(benchmark::kMillisecond);
+
+// Many request threads share a pool with a fixed number of hashing threads;
+// throughput levels off at the pool size instead of the request count
+static void BM_PooledVerify(benchmark::State& state) {
+    static std::unique_ptr<PooledPasswordHasher> hasher;
+    static std::string encoded;
+    if (state.thread_index() == 0) {
+        hasher = std::make_unique<PooledPasswordHasher>(std::make_shared<Pbkdf2PasswordHasher>(10000),
+                                                        static_cast<size_t>(state.range(0)));
+        encoded = hasher->hash("Passw0rd.123");
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher->verify("Passw0rd.123", encoded));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        hasher.reset();
+    }
+}
+BENCHMARK(BM_PooledVerify)->Arg(1)->Arg(2)->Threads(8)->UseRealTime()->Unit(benchmark::kMillisecond);
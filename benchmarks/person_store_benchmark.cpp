@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "person_store.h"
+#include "repository.h"
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Columnar PersonStore vs VectorRepository - 1M users
+// ============================================================================
+
+namespace {
+
+const int64_t userCount = 1000000;
+
+const std::vector<Person>& users() {
+    static const std::vector<Person> persons = makePersons(userCount);
+    return persons;
+}
+
+size_t heapBytes(const std::pmr::string& value) {
+    // Short strings live inside the std::string object
+    return value.capacity() > 15 ? value.capacity() + 1 : 0;
+}
+
+// sizeof(Person) per element plus the heap blocks of its strings
+size_t vectorFootprint(const std::vector<Person>& persons) {
+    size_t bytes = persons.capacity() * sizeof(Person);
+    for (const auto& person : persons) {
+        bytes += heapBytes(person.id) + heapBytes(person.email) + heapBytes(person.passwordHash) + heapBytes(person.status);
+    }
+    return bytes;
+}
+
+const auto filterByEmail = [](const Person& person, const std::string& email) {
+    return std::string_view(person.email) == email;
+};
+
+// Spread over the whole range, so the average scan covers half the users
+std::string emailFor(int64_t i) {
+    return "user" + std::to_string((i * 7919) % userCount) + "@example.com";
+}
+
+}
+
+static void BM_VectorRepositoryScanByEmail(benchmark::State& state) {
+    VectorRepository<Person> repo(filterByEmail, users());
+    int64_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repo.get(emailFor(i++)));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_user"] = static_cast<double>(vectorFootprint(users())) / userCount;
+}
+BENCHMARK(BM_VectorRepositoryScanByEmail)->Unit(benchmark::kMicrosecond);
+
+static void BM_PersonStoreScanByEmail(benchmark::State& state) {
+    PersonStore store(PersonKey::Email, users());
+    int64_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(store.get(emailFor(i++)));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_user"] = static_cast<double>(store.memoryUsage()) / userCount;
+}
+BENCHMARK(BM_PersonStoreScanByEmail)->Unit(benchmark::kMicrosecond);
+
+// Raw column scan for a hash that is not there: arg 0 scalar, arg 1 dispatched (AVX2 if available)
+static void BM_HashColumnScan(benchmark::State& state) {
+    std::vector<uint64_t> hashes(static_cast<size_t>(userCount));
+    for (size_t i = 0; i < hashes.size(); i++) {
+        hashes[i] = i * 0x9e3779b97f4a7c15ULL | 1;
+    }
+    const bool dispatched = state.range(0) == 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dispatched
+            ? findMatchingHash(hashes.data(), hashes.size(), 0)
+            : findMatchingHashScalar(hashes.data(), hashes.size(), 0));
+    }
+    state.SetItemsProcessed(state.iterations() * userCount);
+    state.SetBytesProcessed(state.iterations() * userCount * static_cast<int64_t>(sizeof(uint64_t)));
+}
+BENCHMARK(BM_HashColumnScan)->ArgName("dispatched")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "pooled_sqlite_repository.h"
+#include "repository.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+// ============================================================================
+// Multi-threaded read benchmarks - shared connection vs connection pool
+// ============================================================================
+
+namespace {
+
+const std::string benchmarkDbPath = "pooled_sqlite_repository_benchmark.db";
+const int64_t rowCount = 10000;
+
+std::unique_ptr<SqliteRepository<Person>> sharedRepo;
+std::unique_ptr<PooledSqliteRepository<Person>> pooledRepo;
+
+void createPersonsFile() {
+    sqlite3* db = openPersonsDb(benchmarkDbPath);
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        repo.insertMany(makePersons(rowCount), personBinder);
+    }
+    sqlite3_close(db);
+}
+
+void removePersonsFile() {
+    std::remove(benchmarkDbPath.c_str());
+    std::remove((benchmarkDbPath + "-wal").c_str());
+    std::remove((benchmarkDbPath + "-shm").c_str());
+}
+
+int maxThreads() {
+    return static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+}
+
+}
+
+// One connection behind SqliteRepository's mutex, shared by all threads
+static void BM_SharedConnectionGet(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        createPersonsFile();
+        sqlite3* db = nullptr;
+        sqlite3_open(benchmarkDbPath.c_str(), &db);
+        sharedRepo = std::make_unique<SqliteRepository<Person>>(db, "persons", personRowMapper, "id", true);
+    }
+    int64_t i = state.thread_index();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sharedRepo->get("id-" + std::to_string((i * 7919) % rowCount)));
+        i += state.threads();
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        sharedRepo.reset();
+        removePersonsFile();
+    }
+}
+BENCHMARK(BM_SharedConnectionGet)->ThreadRange(1, maxThreads())->UseRealTime();
+
+static void BM_PooledConnectionGet(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        createPersonsFile();
+        pooledRepo = std::make_unique<PooledSqliteRepository<Person>>(
+            benchmarkDbPath, static_cast<size_t>(state.threads()), "persons", personRowMapper, "id");
+    }
+    int64_t i = state.thread_index();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pooledRepo->get("id-" + std::to_string((i * 7919) % rowCount)));
+        i += state.threads();
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        pooledRepo.reset();
+        removePersonsFile();
+    }
+}
+BENCHMARK(BM_PooledConnectionGet)->ThreadRange(1, maxThreads())->UseRealTime();
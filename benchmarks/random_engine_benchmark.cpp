@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include "random_engines.h"
+#include "uuid_generator.h"
+#include <random>
+#include <vector>
+
+// ============================================================================
+// Random engine benchmarks - random bytes per second per engine
+// ============================================================================
+
+template<typename Engine>
+static void BM_FillRandomWords(benchmark::State& state) {
+    auto engine = ThreadEngineSeeder<Engine>::create();
+    std::vector<uint64_t> words(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        fillRandomWords(engine, words.data(), words.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(uint64_t)));
+}
+BENCHMARK_TEMPLATE(BM_FillRandomWords, std::mt19937)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_FillRandomWords, std::mt19937_64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_FillRandomWords, Xoshiro256StarStar)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_FillRandomWords, Philox4x32x10)->Arg(1024);
+
+// The original approach: one 4-bit distribution call per hex digit
+static void BM_Mt19937NibbleDistribution(benchmark::State& state) {
+    auto engine = ThreadEngineSeeder<std::mt19937>::create();
+    std::uniform_int_distribution<int> distribution(0, 15);
+    for (auto _ : state) {
+        for (int i = 0; i < 16; i++) {
+            benchmark::DoNotOptimize(distribution(engine));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * 8);
+}
+BENCHMARK(BM_Mt19937NibbleDistribution);
+
+template<typename Engine>
+static void BM_UuidV4CreateInto(benchmark::State& state) {
+    UuidGeneratorV4<UuidFormatLower, Engine> generator;
+    std::vector<char> buffer(1024 * generator.length());
+    for (auto _ : state) {
+        generator.createInto(buffer.data(), 1024);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+    state.SetBytesProcessed(state.iterations() * 1024 * 16);
+}
+BENCHMARK_TEMPLATE(BM_UuidV4CreateInto, std::mt19937);
+BENCHMARK_TEMPLATE(BM_UuidV4CreateInto, std::mt19937_64);
+BENCHMARK_TEMPLATE(BM_UuidV4CreateInto, Xoshiro256StarStar);
+BENCHMARK_TEMPLATE(BM_UuidV4CreateInto, Philox4x32x10);
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "repository.h"
+#include <string>
+#include <vector>
+
+// ============================================================================
+// In-memory repository benchmarks - lookups per second
+// ============================================================================
+
+namespace {
+
+// Emails spread over the whole repository, so the linear scan averages n/2
+std::vector<std::string> makeLookupKeys(int64_t count) {
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < 1024; i++) {
+        keys.push_back("user" + std::to_string((i * 7919) % count) + "@example.com");
+    }
+    return keys;
+}
+
+}
+
+static void BM_VectorRepositoryGet(benchmark::State& state) {
+    VectorRepository<Person> repo(
+        [](const Person& p, const std::string& email) { return std::string_view(p.email) == email; },
+        makePersons(state.range(0))
+    );
+    const auto keys = makeLookupKeys(state.range(0));
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repo.get(keys[i++ % keys.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VectorRepositoryGet)->Arg(1000)->Arg(10000)->Arg(50000);
+
+static void BM_IndexedVectorRepositoryGet(benchmark::State& state) {
+    IndexedVectorRepository<Person> repo(
+        [](const Person& p) { return std::string(p.email); },
+        makePersons(state.range(0))
+    );
+    const auto keys = makeLookupKeys(state.range(0));
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repo.get(keys[i++ % keys.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IndexedVectorRepositoryGet)->Arg(1000)->Arg(10000)->Arg(50000);
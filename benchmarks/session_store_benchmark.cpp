@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include "session_store.h"
+#include "uuid_generator.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// SessionStore - concurrent session validation
+// ============================================================================
+
+namespace {
+
+const size_t sessionCount = 100000;
+
+const std::vector<std::string>& sessionIds() {
+    static const std::vector<std::string> ids = UuidGeneratorRandomImpl().createBatch(sessionCount);
+    return ids;
+}
+
+std::unique_ptr<SessionStore> makeStore(size_t shardCount) {
+    auto store = std::make_unique<SessionStore>(SessionStoreOptions{sessionCount * 2, shardCount});
+    for (const auto& id : sessionIds()) {
+        store->put({"user", id});
+    }
+    return store;
+}
+
+std::unique_ptr<SessionStore> store;
+
+}
+
+// Arg 0 is the shard count; a single shard shows the lock contention that
+// sharding removes
+static void BM_SessionLookup(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        store = makeStore(static_cast<size_t>(state.range(0)));
+    }
+    const auto& ids = sessionIds();
+    size_t i = static_cast<size_t>(state.thread_index()) * 7919;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(store->contains(ids[i++ % ids.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        store.reset();
+    }
+}
+BENCHMARK(BM_SessionLookup)->Arg(1)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
+
+// One in 16 operations creates a session, the rest validate one
+static void BM_SessionMixedLookupAndCreate(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        store = makeStore(static_cast<size_t>(state.range(0)));
+    }
+    const auto& ids = sessionIds();
+    const std::string prefix = "t" + std::to_string(state.thread_index()) + "-";
+    size_t i = static_cast<size_t>(state.thread_index()) * 7919;
+    for (auto _ : state) {
+        if (i % 16 == 0) {
+            store->put({"user", prefix + std::to_string(i)});
+        } else {
+            benchmark::DoNotOptimize(store->get(ids[i % ids.size()]));
+        }
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        store.reset();
+    }
+}
+BENCHMARK(BM_SessionMixedLookupAndCreate)->Arg(1)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
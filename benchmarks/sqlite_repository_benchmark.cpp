@@ -0,0 +1,255 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "caching_repository.h"
+#include "repository.h"
+#include "alloc_counter.h"
+#include <sqlite3.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// SqliteRepository benchmarks - point lookups and inserts per second
+// ============================================================================
+
+namespace {
+
+const int64_t rowCount = 10000;
+
+// Arg 0: in-memory DB, arg 1: on-disk DB
+std::string dbPathFor(const benchmark::State& state) {
+    return state.range(0) == 0 ? ":memory:" : "sqlite_repository_benchmark.db";
+}
+
+void fillPersons(sqlite3* db, SqliteRepository<Person>& repo) {
+    sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+    for (int64_t i = 0; i < rowCount; i++) {
+        repo.insert(makePerson(i), personBinder);
+    }
+    sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+}
+
+std::string lookupId(int64_t i) {
+    return "id-" + std::to_string((i * 7919) % rowCount);
+}
+
+}
+
+static void BM_SqliteRepositoryGet(benchmark::State& state) {
+    const auto path = dbPathFor(state);
+    sqlite3* db = openPersonsDb(path);
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        fillPersons(db, repo);
+        int64_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(repo.get(lookupId(i++)));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    closePersonsDb(db, path);
+}
+BENCHMARK(BM_SqliteRepositoryGet)->ArgName("onDisk")->Arg(0)->Arg(1);
+
+// Baseline: what get() did before statements were cached
+static void BM_PrepareEachLookup(benchmark::State& state) {
+    const auto path = dbPathFor(state);
+    sqlite3* db = openPersonsDb(path);
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        fillPersons(db, repo);
+        int64_t i = 0;
+        for (auto _ : state) {
+            const std::string sql = "SELECT * FROM persons WHERE id = ?";
+            sqlite3_stmt* stmt;
+            sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+            const auto id = lookupId(i++);
+            sqlite3_bind_text(stmt, 1, id.c_str(), -1, SQLITE_TRANSIENT);
+            if (sqlite3_step(stmt) == SQLITE_ROW) {
+                benchmark::DoNotOptimize(personRowMapper(stmt));
+            }
+            sqlite3_finalize(stmt);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    closePersonsDb(db, path);
+}
+BENCHMARK(BM_PrepareEachLookup)->ArgName("onDisk")->Arg(0)->Arg(1);
+
+// One implicit transaction, and therefore one journal sync, per row
+static void BM_InsertPerRowOnDisk(benchmark::State& state) {
+    const std::string path = "sqlite_repository_benchmark.db";
+    const auto persons = makePersons(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        sqlite3* db = openPersonsDb(path);
+        state.ResumeTiming();
+        {
+            SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+            for (const auto& person : persons) {
+                repo.insert(person, personBinder);
+            }
+        }
+        state.PauseTiming();
+        closePersonsDb(db, path);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InsertPerRowOnDisk)->Arg(1000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void BM_InsertManyOnDisk(benchmark::State& state) {
+    const std::string path = "sqlite_repository_benchmark.db";
+    const auto persons = makePersons(state.range(0));
+    const auto batchSize = static_cast<size_t>(state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        sqlite3* db = openPersonsDb(path);
+        state.ResumeTiming();
+        {
+            SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+            auto result = repo.insertMany(persons, personBinder, batchSize);
+            state.counters["rows_per_second"] = result.rowsPerSecond();
+        }
+        state.PauseTiming();
+        closePersonsDb(db, path);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InsertManyOnDisk)
+    ->ArgNames({"rows", "batchSize"})
+    ->Args({1000000, 100})
+    ->Args({1000000, 10000})
+    ->Args({1000000, 100000})
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SqliteRepositoryGetPerKey(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        fillPersons(db, repo);
+        std::vector<std::string> ids;
+        for (int64_t i = 0; i < state.range(0); i++) {
+            ids.push_back(lookupId(i));
+        }
+        for (auto _ : state) {
+            for (const auto& id : ids) {
+                benchmark::DoNotOptimize(repo.get(id));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryGetPerKey)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_SqliteRepositoryGetMany(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        fillPersons(db, repo);
+        std::vector<std::string> ids;
+        for (int64_t i = 0; i < state.range(0); i++) {
+            ids.push_back(lookupId(i));
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(repo.getMany(ids));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryGetMany)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Authentication looks persons up by email and only needs id, passwordHash
+// and status
+
+static void BM_SqliteRepositoryGetForAuth(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "email");
+        fillPersons(db, repo);
+        sqlite3_exec(db, "CREATE INDEX persons_email ON persons(email)", nullptr, nullptr, nullptr);
+        const std::string email = "user4711@example.com";
+        const uint64_t allocationsBefore = allocationCount.load();
+        for (auto _ : state) {
+            auto person = repo.get(email);
+            benchmark::DoNotOptimize(person->passwordHash.size() + person->status.size());
+        }
+        state.counters["allocs_per_lookup"] = benchmark::Counter(
+            static_cast<double>(allocationCount.load() - allocationsBefore), benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(state.iterations());
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryGetForAuth);
+
+static void BM_SqliteRepositoryWithRowProjection(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "email");
+        fillPersons(db, repo);
+        sqlite3_exec(db, "CREATE INDEX persons_email ON persons(email)", nullptr, nullptr, nullptr);
+        auto authColumns = repo.prepareProjection({"id", "passwordHash", "status"});
+        const std::string_view email = "user4711@example.com";
+        const uint64_t allocationsBefore = allocationCount.load();
+        for (auto _ : state) {
+            repo.withRow(authColumns, email, [](const SqliteRowView& row) {
+                benchmark::DoNotOptimize(row.text(1).size() + row.text(2).size());
+            });
+        }
+        state.counters["allocs_per_lookup"] = benchmark::Counter(
+            static_cast<double>(allocationCount.load() - allocationsBefore), benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(state.iterations());
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryWithRowProjection);
+
+// Hot accounts: 1000 distinct IDs looked up over and over, arg 1 adds the cache
+static void BM_SqliteRepositoryHotKeys(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        auto sqliteRepo = std::make_shared<SqliteRepository<Person>>(db, "persons", personRowMapper, "id");
+        fillPersons(db, *sqliteRepo);
+        std::shared_ptr<IRepository<Person>> repo = sqliteRepo;
+        std::shared_ptr<CachingRepository<Person>> cache;
+        if (state.range(0) == 1) {
+            cache = std::make_shared<CachingRepository<Person>>(sqliteRepo);
+            repo = cache;
+        }
+        int64_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(repo->get("id-" + std::to_string((i++ * 7919) % 1000)));
+        }
+        state.SetItemsProcessed(state.iterations());
+        if (cache) {
+            state.counters["hit_rate"] = cache->stats().hitRate();
+        }
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryHotKeys)->ArgName("cached")->Arg(0)->Arg(1);
+
+// Credential stuffing: the same unknown IDs again and again
+static void BM_SqliteRepositoryUnknownKeys(benchmark::State& state) {
+    sqlite3* db = openPersonsDb(":memory:");
+    {
+        auto sqliteRepo = std::make_shared<SqliteRepository<Person>>(db, "persons", personRowMapper, "id");
+        fillPersons(db, *sqliteRepo);
+        std::shared_ptr<IRepository<Person>> repo = sqliteRepo;
+        if (state.range(0) == 1) {
+            repo = std::make_shared<CachingRepository<Person>>(sqliteRepo);
+        }
+        int64_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(repo->get("unknown-" + std::to_string(i++ % 100)));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    closePersonsDb(db, ":memory:");
+}
+BENCHMARK(BM_SqliteRepositoryUnknownKeys)->ArgName("cached")->Arg(0)->Arg(1);
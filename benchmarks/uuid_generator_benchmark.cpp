@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+#include "uuid_generator.h"
+#include "pooled_uuid_generator.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// UUID Generator Benchmarks - IDs per second
+// ============================================================================
+
+static void BM_NaiveRandomCreate(benchmark::State& state) {
+    UuidGeneratorNaiveRandomImpl generator;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.create());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NaiveRandomCreate);
+
+static void BM_RandomCreate(benchmark::State& state) {
+    UuidGeneratorRandomImpl generator;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.create());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomCreate);
+
+static void BM_RandomCreateBatch(benchmark::State& state) {
+    UuidGeneratorRandomImpl generator;
+    const auto n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.createBatch(n));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomCreateBatch)->Arg(64)->Arg(4096);
+
+static void BM_RandomCreateInto(benchmark::State& state) {
+    UuidGeneratorRandomImpl generator;
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<char> buffer(n * generator.length());
+    for (auto _ : state) {
+        generator.createInto(buffer.data(), n);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomCreateInto)->Arg(64)->Arg(4096);
+
+static void BM_PooledRandomCreate(benchmark::State& state) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>(), 1024);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator.create());
+    }
+    auto stats = generator.stats();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hit_rate"] = static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses);
+}
+BENCHMARK(BM_PooledRandomCreate);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_persons.h"
+#include "repository.h"
+#include "uuid_generator.h"
+#include <sqlite3.h>
+#include <string>
+
+// ============================================================================
+// Insert throughput into a SqliteRepository-backed table: v4 vs v7 keys
+// ============================================================================
+
+namespace {
+
+const std::string benchmarkDbPath = "uuid_key_insert_benchmark.db";
+
+// Rows are committed in transactions of 1000 so the timing is dominated by
+// the primary key B-tree rather than by journal syncs.
+void insertWithKeys(benchmark::State& state, UuidGenerator& generator) {
+    sqlite3* db = openPersonsDb(benchmarkDbPath);
+    sqlite3_exec(db, "PRAGMA synchronous = OFF; PRAGMA cache_size = -16384", nullptr, nullptr, nullptr);
+    {
+        SqliteRepository<Person> repo(db, "persons", personRowMapper, "id");
+        Person person{"", "user@example.com", "hash", "active"};
+        int64_t rows = 0;
+
+        sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+        for (auto _ : state) {
+            person.id = generator.create();
+            repo.insert(person, personBinder);
+            if (++rows % 1000 == 0) {
+                sqlite3_exec(db, "COMMIT; BEGIN", nullptr, nullptr, nullptr);
+            }
+        }
+        sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+        state.SetItemsProcessed(rows);
+    }
+    closePersonsDb(db, benchmarkDbPath);
+}
+
+}
+
+static void BM_InsertWithV4Keys(benchmark::State& state) {
+    UuidGeneratorV4<UuidFormatLowerDashed> generator;
+    insertWithKeys(state, generator);
+}
+BENCHMARK(BM_InsertWithV4Keys)->Iterations(500000)->Unit(benchmark::kMicrosecond);
+
+static void BM_InsertWithV7Keys(benchmark::State& state) {
+    UuidGeneratorV7<UuidFormatLowerDashed> generator;
+    insertWithKeys(state, generator);
+}
+BENCHMARK(BM_InsertWithV7Keys)->Iterations(500000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "repository.h"
+#include "thread_pool.h"
+
+// ============================================================================
+// Asynchronous Repository Interface
+// ============================================================================
+
+// Lookups return immediately with a future, so a caller can have many of
+// them in flight and collect the results later. A RepositoryException from
+// the lookup is rethrown by future::get().
+template<typename T>
+class IAsyncRepository {
+public:
+    virtual ~IAsyncRepository() = default;
+    virtual std::future<std::optional<T>> getAsync(const std::string& id) = 0;
+
+    virtual std::vector<std::future<std::optional<T>>> getManyAsync(const std::vector<std::string>& ids) {
+        std::vector<std::future<std::optional<T>>> results;
+        results.reserve(ids.size());
+        for (const auto& id : ids) {
+            results.push_back(getAsync(id));
+        }
+        return results;
+    }
+};
+
+// ============================================================================
+// Executor-backed adapter - runs a synchronous repository on a ThreadPool
+// ============================================================================
+
+// The pool's bounded queue limits the requests in flight: getAsync() blocks
+// once it is full. A single SqliteRepository serializes its lookups on its
+// mutex, so wrap a PooledSqliteRepository to get parallel I/O.
+template<typename T>
+class ExecutorRepository : public IAsyncRepository<T> {
+private:
+    std::shared_ptr<IRepository<T>> inner;
+    std::shared_ptr<ThreadPool> pool;
+
+public:
+    ExecutorRepository(std::shared_ptr<IRepository<T>> repository, std::shared_ptr<ThreadPool> executor)
+        : inner(std::move(repository)), pool(std::move(executor)) {}
+
+    std::future<std::optional<T>> getAsync(const std::string& id) override {
+        auto repository = inner;
+        return pool->submit([repository, id] { return repository->get(id); });
+    }
+};
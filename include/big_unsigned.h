@@ -0,0 +1,79 @@
+#ifndef BIG_UNSIGNED_H
+#define BIG_UNSIGNED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Arbitrary-precision unsigned integer with 64-bit limbs, least significant
+ * limb first and no leading zero limbs (zero has no limbs).
+ *
+ * Multiplication switches from schoolbook to Karatsuba once both operands
+ * have karatsubaThreshold limbs. toString() splits by powers of 10^19 with
+ * a divide-and-conquer scheme whose divisions are Barrett reductions, so it
+ * scales like multiplication instead of quadratically.
+ */
+class BigUnsigned {
+public:
+    static constexpr size_t karatsubaThreshold = 32;
+
+    BigUnsigned() = default;
+    BigUnsigned(uint64_t value);
+
+    /**
+     * Parse a string of decimal digits.
+     *
+     * @throws std::invalid_argument if text is empty or not all digits
+     */
+    static BigUnsigned fromString(std::string_view text);
+
+    /**
+     * Multiply with the schoolbook method regardless of size; exposed for the
+     * tests and the benchmark.
+     */
+    static BigUnsigned multiplySchoolbook(const BigUnsigned& a, const BigUnsigned& b);
+
+    BigUnsigned operator+(const BigUnsigned& other) const;
+    BigUnsigned operator*(const BigUnsigned& other) const;
+
+    /**
+     * @throws std::underflow_error if other is larger than this
+     */
+    BigUnsigned operator-(const BigUnsigned& other) const;
+
+    BigUnsigned operator<<(size_t bits) const;
+    BigUnsigned operator>>(size_t bits) const;
+
+    bool operator==(const BigUnsigned& other) const { return limbs == other.limbs; }
+    bool operator!=(const BigUnsigned& other) const { return limbs != other.limbs; }
+    bool operator<(const BigUnsigned& other) const { return compare(other) < 0; }
+    bool operator<=(const BigUnsigned& other) const { return compare(other) <= 0; }
+    bool operator>(const BigUnsigned& other) const { return compare(other) > 0; }
+    bool operator>=(const BigUnsigned& other) const { return compare(other) >= 0; }
+
+    bool isZero() const { return limbs.empty(); }
+    size_t limbCount() const { return limbs.size(); }
+    size_t bitLength() const;
+
+    /**
+     * The value modulo divisor.
+     *
+     * @throws std::invalid_argument if divisor is zero
+     */
+    uint64_t mod(uint64_t divisor) const;
+
+    std::string toString() const;
+
+private:
+    std::vector<uint64_t> limbs;
+
+    int compare(const BigUnsigned& other) const;
+    void trim();
+
+    friend class DecimalConverter;
+};
+
+#endif // BIG_UNSIGNED_H
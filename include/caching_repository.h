@@ -0,0 +1,236 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "repository.h"
+
+// ============================================================================
+// Caching Repository - read-through decorator over any IRepository<T>
+// ============================================================================
+
+struct CachingRepositoryOptions {
+    size_t capacity = 10000;                         // entries over all shards
+    size_t shardCount = 16;
+    std::chrono::milliseconds ttl{30000};            // found items
+    std::chrono::milliseconds negativeTtl{2000};     // "not found" results
+};
+
+// Keeps get() results in a sharded LRU. Each shard has its own mutex, so
+// lookups of different keys rarely contend. Entries expire after ttl, and
+// "not found" results after the shorter negativeTtl, which absorbs repeated
+// lookups of unknown IDs without hiding new rows for long.
+//
+// Concurrent misses on the same key are collapsed: the first caller loads
+// from the backend and the others wait for its result. Backend exceptions
+// reach every waiting caller and are never cached.
+//
+// invalidate() and clear() detach loads in flight: their result still goes
+// to the callers already waiting for it but isn't cached, and later lookups
+// start a fresh load.
+template<typename T>
+class CachingRepository : public IRepository<T> {
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    struct Stats {
+        uint64_t hits;          // served from the cache, including negative entries
+        uint64_t negativeHits;  // the part of hits that were cached "not found"
+        uint64_t misses;        // caused a backend call
+        uint64_t coalesced;     // waited for another caller's backend call
+
+        double hitRate() const {
+            const uint64_t total = hits + misses + coalesced;
+            return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+private:
+    struct Entry {
+        std::string key;
+        std::optional<T> value;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    // A backend load; generation tells it apart from a later load of the
+    // same key started after an invalidation
+    struct Flight {
+        std::shared_future<std::optional<T>> result;
+        uint64_t generation;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<Entry> lru;  // most recently used first
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> entries;
+        std::unordered_map<std::string, Flight> inFlight;
+        uint64_t nextGeneration = 0;
+    };
+
+    std::shared_ptr<IRepository<T>> inner;
+    CachingRepositoryOptions options;
+    Clock clock;
+    size_t shardCapacity;
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> negativeHits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> coalesced{0};
+
+    static std::chrono::steady_clock::time_point steadyNow() {
+        return std::chrono::steady_clock::now();
+    }
+
+    Shard& shardFor(const std::string& id) {
+        return *shards[std::hash<std::string>{}(id) % shards.size()];
+    }
+
+    // Called with the shard locked; true if the load is still the key's
+    // current one, i.e. wasn't detached by invalidate() or clear()
+    static bool finishFlight(Shard& shard, const std::string& id, uint64_t generation) {
+        auto flight = shard.inFlight.find(id);
+        if (flight == shard.inFlight.end() || flight->second.generation != generation) {
+            return false;
+        }
+        shard.inFlight.erase(flight);
+        return true;
+    }
+
+    // Called with the shard locked
+    void store(Shard& shard, const std::string& id, const std::optional<T>& value) {
+        const auto expiresAt = clock() + (value ? options.ttl : options.negativeTtl);
+        auto it = shard.entries.find(id);
+        if (it != shard.entries.end()) {
+            it->second->value = value;
+            it->second->expiresAt = expiresAt;
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            return;
+        }
+        if (shard.lru.size() >= shardCapacity) {
+            shard.entries.erase(shard.lru.back().key);
+            shard.lru.pop_back();
+        }
+        shard.lru.push_front(Entry{id, value, expiresAt});
+        shard.entries.emplace(id, shard.lru.begin());
+    }
+
+public:
+    explicit CachingRepository(
+        std::shared_ptr<IRepository<T>> repository,
+        CachingRepositoryOptions cacheOptions = {},
+        Clock now = steadyNow
+    ) : inner(std::move(repository)), options(cacheOptions), clock(std::move(now)) {
+        if (options.capacity == 0 || options.shardCount == 0) {
+            throw std::invalid_argument("capacity and shardCount must be at least 1");
+        }
+        shardCapacity = (options.capacity + options.shardCount - 1) / options.shardCount;
+        shards.reserve(options.shardCount);
+        for (size_t i = 0; i < options.shardCount; i++) {
+            shards.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    std::optional<T> get(const std::string& id) override {
+        Shard& shard = shardFor(id);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(id);
+        if (it != shard.entries.end()) {
+            if (it->second->expiresAt > clock()) {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                hits.fetch_add(1, std::memory_order_relaxed);
+                if (!it->second->value) {
+                    negativeHits.fetch_add(1, std::memory_order_relaxed);
+                }
+                return it->second->value;
+            }
+            shard.lru.erase(it->second);
+            shard.entries.erase(it);
+        }
+
+        auto flight = shard.inFlight.find(id);
+        if (flight != shard.inFlight.end()) {
+            auto result = flight->second.result;
+            lock.unlock();
+            coalesced.fetch_add(1, std::memory_order_relaxed);
+            return result.get();
+        }
+
+        std::promise<std::optional<T>> promise;
+        const uint64_t generation = shard.nextGeneration++;
+        shard.inFlight.emplace(id, Flight{promise.get_future().share(), generation});
+        lock.unlock();
+        misses.fetch_add(1, std::memory_order_relaxed);
+
+        std::optional<T> value;
+        try {
+            value = inner->get(id);
+        } catch (...) {
+            lock.lock();
+            finishFlight(shard, id, generation);
+            lock.unlock();
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        lock.lock();
+        if (finishFlight(shard, id, generation)) {
+            store(shard, id, value);
+        }
+        lock.unlock();
+        promise.set_value(value);
+        return value;
+    }
+
+    // Drops the cached result for id, e.g. after the row was written, and
+    // detaches a load of id in flight, which may have read the old row
+    void invalidate(const std::string& id) {
+        Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(id);
+        if (it != shard.entries.end()) {
+            shard.lru.erase(it->second);
+            shard.entries.erase(it);
+        }
+        shard.inFlight.erase(id);
+    }
+
+    void clear() {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->entries.clear();
+            shard->lru.clear();
+            shard->inFlight.clear();
+        }
+    }
+
+    size_t size() {
+        size_t total = 0;
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            total += shard->lru.size();
+        }
+        return total;
+    }
+
+    Stats stats() const {
+        return {
+            hits.load(std::memory_order_relaxed),
+            negativeHits.load(std::memory_order_relaxed),
+            misses.load(std::memory_order_relaxed),
+            coalesced.load(std::memory_order_relaxed)
+        };
+    }
+};
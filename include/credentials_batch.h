@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "thread_pool.h"
+#include "uss.h"
+
+// ============================================================================
+// Batch Credentials Validation
+// ============================================================================
+
+// Output buffers for validateBatch, meant to be kept and reused. Slots are
+// never shrunk, so the sanitized strings keep their capacity and a stream of
+// similar batches stops allocating after the first one.
+//
+// Credentials have one error slot per field; the messages are the static
+// strings of the try* validators.
+class CredentialsBatchResult {
+private:
+    size_t count = 0;
+    std::vector<Credentials> sanitized;
+    std::vector<const char*> emailErrors;
+    std::vector<const char*> passwordErrors;
+
+    void prepare(size_t items);
+    void validateRange(const Credentials* inputs, size_t begin, size_t end);
+
+    friend void validateBatch(const Credentials* inputs, size_t count, CredentialsBatchResult& result,
+                              ThreadPool* pool, size_t minItemsPerTask);
+
+public:
+    void reserve(size_t capacity);
+
+    size_t size() const {
+        return count;
+    }
+
+    bool ok(size_t i) const {
+        return emailErrors[i] == nullptr && passwordErrors[i] == nullptr;
+    }
+
+    // Only meaningful when ok(i)
+    const Credentials& value(size_t i) const {
+        return sanitized[i];
+    }
+
+    const char* emailError(size_t i) const {
+        return emailErrors[i];
+    }
+
+    const char* passwordError(size_t i) const {
+        return passwordErrors[i];
+    }
+
+    // The errors of item i in the form validateCredentials() reports them
+    std::pmr::vector<ValidationError> errors(size_t i, const RequestAllocator& alloc = {}) const;
+
+    size_t validCount() const;
+};
+
+// Validates inputs[0, count) into result; item i is the sanitized form of
+// inputs[i]. With a pool, batches of at least two tasks' worth are split into
+// contiguous chunks, one per worker, and the calling thread takes the last
+// chunk. Don't pass the pool the caller itself runs on: the caller blocks
+// until every chunk is done.
+void validateBatch(const Credentials* inputs, size_t count, CredentialsBatchResult& result,
+                   ThreadPool* pool = nullptr, size_t minItemsPerTask = 256);
+
+inline void validateBatch(const std::vector<Credentials>& inputs, CredentialsBatchResult& result,
+                          ThreadPool* pool = nullptr, size_t minItemsPerTask = 256) {
+    validateBatch(inputs.data(), inputs.size(), result, pool, minItemsPerTask);
+}
@@ -1,20 +1,162 @@
 #ifndef FIBONACCI_H
 #define FIBONACCI_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "big_unsigned.h"
+
+namespace fibonacci_detail {
+
+constexpr std::array<int64_t, 93> makeTable() {
+    std::array<int64_t, 93> table{};
+    table[1] = 1;
+    for (size_t i = 2; i < table.size(); i++) {
+        table[i] = table[i - 1] + table[i - 2];
+    }
+    return table;
+}
+
+inline constexpr std::array<int64_t, 93> table = makeTable();
+
+}
+
+/**
+ * Tables of F(i) mod m over one Pisano period, for moduli up to maxModulus.
+ *
+ * F(n) mod m repeats with period pi(m) <= 6m, so once a table is built every
+ * F(n) mod m is a single lookup. Building a table costs O(pi(m)), which pays
+ * off when many indices share a small modulus. Thread-safe; holds at most
+ * maxTables tables and drops the oldest one to make room.
+ *
+ * maxModulus is capped at modulusLimit (2^20), so one table holds at most
+ * 6 * 2^20 entries, 24 MiB, and the whole cache maxTables times that.
+ */
+class PisanoCache {
+public:
+    static constexpr uint64_t modulusLimit = uint64_t{1} << 20;
+
+    /**
+     * @throws std::invalid_argument if maxModulus is above modulusLimit or
+     *         maxTables is zero
+     */
+    explicit PisanoCache(uint64_t maxModulus = 1 << 16, size_t maxTables = 8);
+
+    /**
+     * The Pisano period of modulus, the length of the cycle of F(i) mod m.
+     *
+     * @throws std::invalid_argument if modulus is zero
+     */
+    static uint64_t period(uint64_t modulus);
+
+    /**
+     * The table for modulus, built on first use; entry i is F(i) mod modulus
+     * and the size is the period.
+     *
+     * @return The table, or nullptr if modulus is zero or above maxModulus
+     */
+    std::shared_ptr<const std::vector<uint32_t>> table(uint64_t modulus);
+
+    size_t size() const;
+
+private:
+    uint64_t maxModulus;
+    size_t maxTables;
+    mutable std::mutex mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<const std::vector<uint32_t>>> tables;
+    std::deque<uint64_t> order;   // oldest first
+};
 
 /**
  * Fibonacci calculator.
  */
 class Fibonacci {
 public:
+    /**
+     * The largest index whose Fibonacci number fits in an int64_t.
+     */
+    static constexpr int maxIndex = 92;
+
     /**
      * Calculate the Fibonacci number at the given index.
      *
+     * Looks the value up in a table built at compile time, so calls with a
+     * constant index are folded by the compiler.
+     *
+     * @param index The index of the Fibonacci number to calculate
+     * @return The Fibonacci number at the given index
+     * @throws std::invalid_argument if index is negative
+     * @throws std::overflow_error if index is above maxIndex
+     */
+    constexpr int64_t calc(int index) const {
+        if (index < 0) {
+            throw std::invalid_argument("Index must not be negative");
+        }
+        if (index > maxIndex) {
+            throw std::overflow_error("Fibonacci number for index above 92 does not fit in int64_t");
+        }
+        return fibonacci_detail::table[static_cast<size_t>(index)];
+    }
+
+    /**
+     * Calculate the Fibonacci number at the given index modulo m.
+     *
+     * Uses fast doubling, F(2k) = F(k) * (2 F(k+1) - F(k)) and
+     * F(2k+1) = F(k)^2 + F(k+1)^2, so it takes O(log n) steps for any index.
+     *
+     * @param index The index of the Fibonacci number to calculate
+     * @param modulus The modulus, at least 1
+     * @return F(index) mod modulus
+     * @throws std::invalid_argument if modulus is zero
+     */
+    uint64_t calcMod(uint64_t index, uint64_t modulus) const;
+
+    /**
+     * Calculate F(index) and F(index + 1) modulo m, the pair fast doubling
+     * ends with; enough to continue the sequence by addition.
+     *
+     * @throws std::invalid_argument if modulus is zero
+     */
+    std::pair<uint64_t, uint64_t> calcModPair(uint64_t index, uint64_t modulus) const;
+
+    /**
+     * Calculate F(indices[i]) mod modulus into out[i] for i in [0, count).
+     *
+     * Moduli below 2^32 avoid the division per step: odd ones run fast
+     * doubling in Montgomery form, four indices per AVX2 vector when the CPU
+     * supports it, and even ones use Barrett reduction. Larger moduli use
+     * calcMod for each index. With a cache that holds a table for modulus,
+     * every result is a table lookup instead.
+     *
+     * @throws std::invalid_argument if modulus is zero
+     */
+    void calcModBatch(const uint64_t* indices, size_t count, uint64_t modulus, uint64_t* out,
+                      PisanoCache* cache = nullptr) const;
+
+    std::vector<uint64_t> calcModBatch(const std::vector<uint64_t>& indices, uint64_t modulus,
+                                       PisanoCache* cache = nullptr) const {
+        std::vector<uint64_t> out(indices.size());
+        calcModBatch(indices.data(), indices.size(), modulus, out.data(), cache);
+        return out;
+    }
+
+    /**
+     * Calculate the Fibonacci number at the given index without a size limit.
+     *
+     * Uses the same fast doubling as calcMod on BigUnsigned values; the cost
+     * is dominated by the last few multiplications, which use Karatsuba.
+     *
      * @param index The index of the Fibonacci number to calculate
      * @return The Fibonacci number at the given index
      */
-    int64_t calc(int index) const;
+    BigUnsigned calcBig(uint64_t index) const;
 };
 
 #endif // FIBONACCI_H
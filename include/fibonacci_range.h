@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "thread_pool.h"
+
+// ============================================================================
+// Fibonacci Ranges - F(first .. first + count - 1) mod m
+// ============================================================================
+
+namespace fibonacci_detail {
+
+// Throws std::invalid_argument for the arguments fibonacciModRange rejects
+void checkRange(uint64_t first, size_t count, uint64_t modulus);
+
+// Numbers per buffer of the streaming fibonacciModRange: bufferSize, raised
+// to one chunk of minItemsPerTask for each worker and one for the caller
+inline size_t streamBufferSize(const ThreadPool* pool, size_t minItemsPerTask, size_t bufferSize) {
+    if (pool == nullptr) {
+        return std::max<size_t>(bufferSize, 1);
+    }
+    return std::max(bufferSize, (pool->threadCount() + 1) * std::max<size_t>(minItemsPerTask, 1));
+}
+
+}
+
+// Writes F(first + i) mod modulus to out[i] for i in [0, count) and returns
+// out + count. Each chunk of minItemsPerTask indices is seeded with one fast
+// doubling jump and filled by the recurrence, one addition per number.
+//
+// With a pool, the chunks are claimed from one shared atomic counter by up to
+// threadCount() workers and the calling thread, so a thread that finishes
+// early takes the next chunk instead of idling. Don't pass the pool the
+// caller itself runs on: the caller blocks until every chunk is done.
+//
+// Throws std::invalid_argument if modulus is zero or the range ends past
+// index 2^64 - 1.
+uint64_t* fibonacciModRange(uint64_t first, size_t count, uint64_t modulus, uint64_t* out,
+                            ThreadPool* pool = nullptr, size_t minItemsPerTask = 16384);
+
+// Streams the same numbers to an output iterator through a buffer of
+// bufferSize numbers, so a long range never has to fit in memory at once.
+// With a pool, the buffer holds at least one chunk of minItemsPerTask per
+// worker and one for the caller, so every buffer keeps the whole pool busy.
+template<typename OutputIt>
+OutputIt fibonacciModRange(uint64_t first, size_t count, uint64_t modulus, OutputIt out,
+                           ThreadPool* pool = nullptr, size_t minItemsPerTask = 16384,
+                           size_t bufferSize = 65536) {
+    // The whole range is checked before anything is written
+    fibonacci_detail::checkRange(first, count, modulus);
+    std::vector<uint64_t> buffer(std::min(count, fibonacci_detail::streamBufferSize(pool, minItemsPerTask, bufferSize)));
+    for (size_t done = 0; done < count;) {
+        const size_t n = std::min(buffer.size(), count - done);
+        fibonacciModRange(first + done, n, modulus, buffer.data(), pool, minItemsPerTask);
+        out = std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(n), out);
+        done += n;
+    }
+    return out;
+}
@@ -1,18 +1,47 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <stdexcept>
 #include <vector>
+#include "password_hasher.h"
 #include "repository.h"
 #include "uss.h"
+#include "uuid_generator.h"
 
+// Validates the credentials, looks the person up by email, verifies the
+// password, checks that the account is active and issues a session ID.
+//
+// Every dependency is injected, so a CachingRepository, a PooledSqliteRepository
+// or a PooledPasswordHasher can be swapped in without touching the pipeline.
+//
+// Throws ValidationException for malformed credentials, ServerException when
+// the repository fails and LoginException otherwise. Unknown emails and wrong
+// passwords get the same message, and an unknown email is still checked
+// against a dummy hash, so neither the answer nor its timing reveals which
+// accounts exist. An inactive account is only reported after its password
+// has been verified.
 class LoginService {
 private:
-    //PersonRepository* personRepo;
-    //std::optional<Person> getPerson(const std::string& email);
+    std::shared_ptr<PersonRepository> personRepo;
+    std::shared_ptr<PasswordHasher> hasher;
+    std::shared_ptr<UuidGenerator> sessionIds;
+    std::once_flag dummyHashOnce;
+    std::string dummyHash;
+
+    std::optional<Person> getPerson(const std::string& email);
 
 public:
-    //explicit LoginService(PersonRepository* repository) : personRepo(repository) {}
+    static constexpr const char* invalidCredentialsMessage = "Invalid email or password";
+    static constexpr const char* inactiveAccountMessage = "Account is not active";
+
+    // Session IDs are bearer tokens, so sessionIdGenerator must draw from a
+    // cryptographically secure generator such as UuidGeneratorSecureV4; the
+    // mt19937_64-based generators' IDs can be predicted from earlier ones.
+    LoginService(std::shared_ptr<PersonRepository> repository, std::shared_ptr<PasswordHasher> passwordHasher,
+                 std::shared_ptr<UuidGenerator> sessionIdGenerator);
 
     Session login(const Credentials& credentials);
 };
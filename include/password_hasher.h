@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "thread_pool.h"
+
+// ============================================================================
+// Password Hasher Interface
+// ============================================================================
+
+class PasswordHasher {
+public:
+    virtual ~PasswordHasher() = default;
+
+    // Returns an encoded hash that carries its own salt and cost, so it can
+    // be verified after the cost setting has changed
+    virtual std::string hash(std::string_view password) = 0;
+
+    // False for a wrong password and for a hash this hasher can't read
+    virtual bool verify(std::string_view password, std::string_view encodedHash) = 0;
+};
+
+// Compares in time that depends only on the lengths, never on where the
+// first difference is
+bool constantTimeEquals(std::string_view a, std::string_view b);
+
+// Exposed for the test vectors
+std::array<uint8_t, 32> sha256(std::string_view data);
+std::vector<uint8_t> pbkdf2HmacSha256(std::string_view password, std::string_view salt,
+                                      uint32_t iterations, size_t keyLength);
+
+// ============================================================================
+// PBKDF2-HMAC-SHA256 Implementation
+// ============================================================================
+
+// Encodes hashes as "pbkdf2-sha256$<iterations>$<salt hex>$<key hex>" with a
+// 16-byte random salt and a 32-byte key. verify() rejects stored iteration
+// counts above maxIterations and keys of any other length, so a tampered
+// hash can't pin a worker.
+class Pbkdf2PasswordHasher : public PasswordHasher {
+private:
+    uint32_t iterationCount;
+    uint32_t iterationLimit;
+
+public:
+    static constexpr uint32_t defaultIterations = 210000;
+    static constexpr size_t saltLength = 16;
+    static constexpr size_t keyLength = 32;
+
+    explicit Pbkdf2PasswordHasher(uint32_t iterations = defaultIterations, uint32_t maxIterations = 10000000);
+
+    std::string hash(std::string_view password) override;
+    bool verify(std::string_view password, std::string_view encodedHash) override;
+
+    uint32_t iterations() const {
+        return iterationCount;
+    }
+};
+
+// ============================================================================
+// Pooled Hasher - bounded, dedicated hashing threads
+// ============================================================================
+
+// Runs the inner hasher on its own ThreadPool, so however many request
+// threads log in at once, at most threadCount hashes are computed and the
+// remaining cores stay free for other request handling.
+//
+// hash() and verify() wait for the result. They block while the queue is
+// full, which pushes back on the request threads. tryVerifyAsync() returns
+// nullopt instead, so a caller can shed load (e.g. answer "busy").
+class PooledPasswordHasher : public PasswordHasher {
+private:
+    std::shared_ptr<PasswordHasher> inner;
+    ThreadPool pool;
+
+public:
+    // Half the hardware threads, at least one
+    static size_t defaultThreadCount();
+
+    PooledPasswordHasher(std::shared_ptr<PasswordHasher> hasher, size_t threadCount = defaultThreadCount(),
+                         size_t queueCapacity = 64);
+
+    std::string hash(std::string_view password) override;
+    bool verify(std::string_view password, std::string_view encodedHash) override;
+
+    std::future<std::string> hashAsync(std::string_view password);
+    std::future<bool> verifyAsync(std::string_view password, std::string_view encodedHash);
+    std::optional<std::future<bool>> tryVerifyAsync(std::string_view password, std::string_view encodedHash);
+
+    size_t threadCount() const {
+        return pool.threadCount();
+    }
+
+    size_t queued() {
+        return pool.queued();
+    }
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "repository.h"
+#include "uss.h"
+
+// ============================================================================
+// Columnar Person Store - structure of arrays
+// ============================================================================
+
+// Append-only string column: all values back to back in one buffer, value i
+// spans offsets[i] .. offsets[i + 1]
+class StringColumn {
+private:
+    std::vector<char> bytes;
+    std::vector<uint32_t> offsets{0};
+
+public:
+    void append(std::string_view value);
+    void reserve(size_t count, size_t totalBytes);
+
+    // Whether append() can take valueBytes more without overflowing the offsets
+    bool fits(size_t valueBytes) const;
+
+    // Drops the values from count on
+    void truncate(size_t count);
+
+    std::string_view operator[](size_t i) const {
+        return std::string_view(bytes.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+
+    size_t size() const {
+        return offsets.size() - 1;
+    }
+
+    size_t memoryUsage() const {
+        return bytes.capacity() + offsets.capacity() * sizeof(uint32_t);
+    }
+};
+
+// Index of the first hashes[i] == hash with i >= from, or count when there is
+// none. Uses AVX2 when the CPU supports it, checked once at runtime.
+size_t findMatchingHash(const uint64_t* hashes, size_t count, uint64_t hash, size_t from = 0);
+size_t findMatchingHashScalar(const uint64_t* hashes, size_t count, uint64_t hash, size_t from = 0);
+
+enum class PersonKey {
+    Id,
+    Email
+};
+
+// Keeps each Person field in its own column. Lookups scan a dense column of
+// 64-bit key hashes, eight per cache line, and only touch the string columns
+// to confirm a candidate and to build the result. status is interned, since
+// accounts share a handful of values.
+//
+// get() looks up the key column chosen at construction; findById() and
+// findByEmail() are always available. As with VectorRepository, the first
+// person added with a given key wins.
+class PersonStore : public PersonRepository {
+private:
+    PersonKey key;
+    StringColumn ids;
+    StringColumn emails;
+    StringColumn passwordHashes;
+    std::vector<uint8_t> statusCodes;
+    std::vector<std::string> statusNames;
+    std::vector<uint64_t> idHashes;
+    std::vector<uint64_t> emailHashes;
+
+    static uint64_t hashValue(std::string_view value) {
+        return std::hash<std::string_view>{}(value);
+    }
+
+    std::optional<size_t> find(const std::vector<uint64_t>& hashes, const StringColumn& column,
+                               std::string_view value) const;
+    uint8_t internStatus(std::string_view status);
+
+public:
+    explicit PersonStore(PersonKey keyColumn = PersonKey::Id, const std::vector<Person>& initialData = {});
+
+    std::optional<Person> get(const std::string& id) override;
+
+    void add(const Person& person);
+
+    // Reserves the per-person columns; string bytes grow as needed
+    void reserve(size_t count);
+
+    std::optional<Person> findById(std::string_view id) const;
+    std::optional<Person> findByEmail(std::string_view email) const;
+    Person at(size_t i) const;
+
+    size_t size() const {
+        return idHashes.size();
+    }
+
+    // Bytes allocated by all columns
+    size_t memoryUsage() const;
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <sqlite3.h>
+#include "repository.h"
+
+// ============================================================================
+// Connection-pooled SQLite Repository Implementation
+// ============================================================================
+
+// Opens poolSize connections to one database file in WAL mode, so readers do
+// not block each other or the writer. Each connection is wrapped in its own
+// SqliteRepository and therefore has its own cached statements.
+//
+// Every call checks out one connection: a thread starts at a preferred
+// connection derived from its thread ID and takes the first free one, and
+// only waits when all of them are busy.
+//
+// ":memory:" would give every connection its own empty database, so pass a
+// file path (or a shared-cache URI).
+template<typename T>
+class PooledSqliteRepository : public IRepository<T> {
+private:
+    struct Connection {
+        std::mutex checkout;
+        std::unique_ptr<SqliteRepository<T>> repo;
+    };
+
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::mutex projectionMutex;    // serializes prepareProjection()
+
+    static sqlite3* openConnection(const std::string& path) {
+        sqlite3* db = nullptr;
+        int result = sqlite3_open_v2(
+            path.c_str(), &db,
+            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI | SQLITE_OPEN_NOMUTEX,
+            nullptr);
+        if (result == SQLITE_OK) {
+            sqlite3_busy_timeout(db, 5000);
+            result = sqlite3_exec(db, "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL",
+                                  nullptr, nullptr, nullptr);
+        }
+        if (result != SQLITE_OK) {
+            std::string message = "Cannot open database " + path + ": " + sqlite3_errmsg(db);
+            sqlite3_close(db);
+            throw RepositoryException(message);
+        }
+        return db;
+    }
+
+    template<typename Fn>
+    auto withConnection(Fn&& fn) {
+        const size_t count = connections.size();
+        const size_t preferred = std::hash<std::thread::id>{}(std::this_thread::get_id()) % count;
+        for (size_t i = 0; i < count; i++) {
+            Connection& connection = *connections[(preferred + i) % count];
+            std::unique_lock<std::mutex> lock(connection.checkout, std::try_to_lock);
+            if (lock.owns_lock()) {
+                return fn(*connection.repo);
+            }
+        }
+        Connection& connection = *connections[preferred];
+        std::lock_guard<std::mutex> lock(connection.checkout);
+        return fn(*connection.repo);
+    }
+
+public:
+    using Projection = typename SqliteRepository<T>::Projection;
+
+    PooledSqliteRepository(
+        const std::string& path,
+        size_t poolSize,
+        const std::string& table,
+        std::function<T(sqlite3_stmt*)> mapper,
+        std::string columnName
+    ) {
+        if (poolSize == 0) {
+            throw std::invalid_argument("poolSize must be at least 1");
+        }
+        connections.reserve(poolSize);
+        for (size_t i = 0; i < poolSize; i++) {
+            auto connection = std::make_unique<Connection>();
+            connection->repo = std::make_unique<SqliteRepository<T>>(
+                openConnection(path), table, mapper, columnName, true);
+            connections.push_back(std::move(connection));
+        }
+    }
+
+    size_t poolSize() const {
+        return connections.size();
+    }
+
+    std::optional<T> get(const std::string& id) override {
+        return withConnection([&id](SqliteRepository<T>& repo) { return repo.get(id); });
+    }
+
+    std::vector<std::optional<T>> getMany(const std::vector<std::string>& ids) override {
+        return withConnection([&ids](SqliteRepository<T>& repo) { return repo.getMany(ids); });
+    }
+
+    template<typename Callback>
+    bool withRow(std::string_view id, Callback&& callback) {
+        return withConnection([&](SqliteRepository<T>& repo) { return repo.withRow(id, callback); });
+    }
+
+    // Prepared on every connection, one call at a time, so each connection
+    // numbers it the same and one handle fits all. If any connection fails,
+    // the ones that already have it drop it again and the error is rethrown.
+    Projection prepareProjection(const std::vector<std::string>& columns) {
+        std::lock_guard<std::mutex> projectionLock(projectionMutex);
+        std::optional<Projection> projection;
+        size_t prepared = 0;
+        try {
+            for (; prepared < connections.size(); prepared++) {
+                Connection& connection = *connections[prepared];
+                std::lock_guard<std::mutex> lock(connection.checkout);
+                const Projection current = connection.repo->prepareProjection(columns);
+                if (projection && current.index != projection->index) {
+                    connection.repo->discardProjection(current);
+                    throw RepositoryException("Connections numbered a projection differently");
+                }
+                projection = current;
+            }
+        } catch (...) {
+            for (size_t i = 0; i < prepared; i++) {
+                std::lock_guard<std::mutex> lock(connections[i]->checkout);
+                connections[i]->repo->discardProjection(*projection);
+            }
+            throw;
+        }
+        return *projection;
+    }
+
+    template<typename Callback>
+    bool withRow(Projection projection, std::string_view id, Callback&& callback) {
+        return withConnection([&](SqliteRepository<T>& repo) { return repo.withRow(projection, id, callback); });
+    }
+
+    // Writes go through any free connection; WAL serializes them and the busy
+    // timeout makes concurrent writers wait instead of failing
+    void insert(const T& item, std::function<void(sqlite3_stmt*, const T&)> binder) {
+        withConnection([&](SqliteRepository<T>& repo) { repo.insert(item, binder); });
+    }
+
+    template<typename Range>
+    BulkInsertResult insertMany(
+        const Range& items,
+        std::function<void(sqlite3_stmt*, const T&)> binder,
+        size_t batchSize = 1000
+    ) {
+        return withConnection([&](SqliteRepository<T>& repo) { return repo.insertMany(items, binder, batchSize); });
+    }
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "uuid_generator.h"
+
+// ============================================================================
+// Pooled UUID Generator - decorator with per-thread pre-generated rings
+// ============================================================================
+
+// Every calling thread gets its own single-producer/single-consumer ring of
+// pre-generated IDs. A background thread refills the rings in batches via
+// the wrapped generator's createInto(), so create() is a lock-free pop. When
+// a ring runs dry the ID is generated inline and counted as a miss.
+//
+// The wrapped generator is called from the background thread and, on
+// misses, from the calling threads, so it must be thread-safe.
+//
+// A thread's ring is unregistered when the thread exits, so threads that come
+// and go don't leave rings behind.
+class PooledUuidGenerator : public UuidGenerator {
+public:
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t rings;     // of threads that haven't exited yet
+    };
+
+    explicit PooledUuidGenerator(std::shared_ptr<UuidGenerator> generator, size_t ringCapacity = 256);
+    ~PooledUuidGenerator() override;
+
+    // Delete copy constructor and assignment
+    PooledUuidGenerator(const PooledUuidGenerator&) = delete;
+    PooledUuidGenerator& operator=(const PooledUuidGenerator&) = delete;
+
+    std::string create() override;
+    size_t length() const override;
+    void createInto(char* out, size_t n) override;
+
+    Stats stats() const;
+
+private:
+    class Ring;
+    struct RingRegistry;
+    struct ThreadRing;
+
+    std::shared_ptr<UuidGenerator> inner;
+    size_t capacity;
+    size_t idLength;
+    uint64_t poolId;
+
+    // Shared with the threads' rings, which may outlive the pool or not
+    std::shared_ptr<RingRegistry> registry;
+
+    std::mutex refillMutex;
+    std::condition_variable refillWanted;
+    bool refillPending = false;
+    bool stopping = false;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+
+    std::thread refiller;
+
+    static std::unordered_map<uint64_t, ThreadRing>& threadRings();
+
+    Ring& threadRing();
+    void popOrGenerate(Ring& ring, char* out);
+    void requestRefill(Ring& ring);
+    void refillLoop();
+};
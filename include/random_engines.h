@@ -0,0 +1,245 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+
+// ============================================================================
+// Random bit engines for the UUID generators
+// ============================================================================
+
+// Both engines satisfy UniformRandomBitGenerator with 64-bit results, so they
+// can be used with <random> distributions as well as with the generators.
+
+// ============================================================================
+// xoshiro256** - 32 bytes of state, see https://prng.di.unimi.it/
+// ============================================================================
+
+class Xoshiro256StarStar {
+private:
+    std::array<uint64_t, 4> s;
+
+    static constexpr uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+public:
+    using result_type = uint64_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // The state is expanded from the seed with SplitMix64, so it is never all zero
+    explicit Xoshiro256StarStar(uint64_t seed = 0) {
+        for (auto& word : s) {
+            word = splitMix64(seed);
+        }
+    }
+
+    explicit Xoshiro256StarStar(const std::array<uint64_t, 4>& state) : s(state) {}
+
+    template<typename SeedSeq, typename = decltype(std::declval<SeedSeq&>().generate(
+        std::declval<uint32_t*>(), std::declval<uint32_t*>()))>
+    explicit Xoshiro256StarStar(SeedSeq& seq) {
+        std::array<uint32_t, 8> words;
+        seq.generate(words.begin(), words.end());
+        for (size_t i = 0; i < 4; i++) {
+            s[i] = (uint64_t{words[2 * i]} << 32) | words[2 * i + 1];
+        }
+        if ((s[0] | s[1] | s[2] | s[3]) == 0) {
+            s[0] = 1;
+        }
+    }
+
+    result_type operator()() {
+        const uint64_t result = rotl(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    void discard(unsigned long long z) {
+        while (z-- > 0) {
+            (*this)();
+        }
+    }
+
+    // Equivalent to 2^128 calls; gives non-overlapping subsequences for
+    // parallel use when engines are derived from one another
+    void jump() {
+        static constexpr uint64_t jumpPolynomial[] = {
+            0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+        };
+        std::array<uint64_t, 4> jumped{};
+        for (uint64_t polynomial : jumpPolynomial) {
+            for (int bit = 0; bit < 64; bit++) {
+                if (polynomial & (uint64_t{1} << bit)) {
+                    for (size_t i = 0; i < 4; i++) {
+                        jumped[i] ^= s[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        s = jumped;
+    }
+};
+
+// ============================================================================
+// Philox4x32-10 - counter-based, see Salmon et al., "Parallel Random Numbers:
+// As Easy as 1, 2, 3" (SC11)
+// ============================================================================
+
+// Output block i is a pure function of (key, stream, i), so threads with
+// different streams never share or contend on state.
+class Philox4x32x10 {
+private:
+    std::array<uint32_t, 2> key;
+    std::array<uint32_t, 4> counter;  // {block low, block high, stream low, stream high}
+    std::array<uint64_t, 2> output{};
+    size_t index = 2;
+
+    static void mulHiLo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        const uint64_t product = uint64_t{a} * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+
+    void generateBlock() {
+        auto x = counter;
+        auto k = key;
+        for (int round = 0; round < 10; round++) {
+            if (round > 0) {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+            uint32_t hi0, lo0, hi1, lo1;
+            mulHiLo(0xD2511F53u, x[0], hi0, lo0);
+            mulHiLo(0xCD9E8D57u, x[2], hi1, lo1);
+            x = {hi1 ^ x[1] ^ k[0], lo1, hi0 ^ x[3] ^ k[1], lo0};
+        }
+        output = {(uint64_t{x[0]} << 32) | x[1], (uint64_t{x[2]} << 32) | x[3]};
+
+        if (++counter[0] == 0) {
+            ++counter[1];
+        }
+    }
+
+public:
+    using result_type = uint64_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit Philox4x32x10(uint64_t seed = 0, uint64_t stream = 0)
+        : key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)},
+          counter{0, 0, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)} {}
+
+    template<typename SeedSeq, typename = decltype(std::declval<SeedSeq&>().generate(
+        std::declval<uint32_t*>(), std::declval<uint32_t*>()))>
+    explicit Philox4x32x10(SeedSeq& seq) : counter{} {
+        seq.generate(key.begin(), key.end());
+    }
+
+    result_type operator()() {
+        if (index == 2) {
+            generateBlock();
+            index = 0;
+        }
+        return output[index++];
+    }
+
+    // O(1): jumps straight to the block holding the z-th next value
+    void discard(unsigned long long z) {
+        const uint64_t remainingInBlock = 2 - index;
+        if (z <= remainingInBlock) {
+            index += static_cast<size_t>(z);
+            return;
+        }
+        z -= remainingInBlock;
+        uint64_t block = (uint64_t{counter[1]} << 32) | counter[0];
+        block += z / 2;
+        counter[0] = static_cast<uint32_t>(block);
+        counter[1] = static_cast<uint32_t>(block >> 32);
+        generateBlock();
+        index = static_cast<size_t>(z % 2);
+    }
+
+    // Raw block function, exposed for known-answer tests
+    static std::array<uint32_t, 4> block(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+        Philox4x32x10 engine;
+        engine.counter = counter;
+        engine.key = key;
+        engine.generateBlock();
+        return {
+            static_cast<uint32_t>(engine.output[0] >> 32), static_cast<uint32_t>(engine.output[0]),
+            static_cast<uint32_t>(engine.output[1] >> 32), static_cast<uint32_t>(engine.output[1])
+        };
+    }
+};
+
+// ============================================================================
+// Thread-local engines
+// ============================================================================
+
+template<typename Engine>
+struct ThreadEngineSeeder {
+    static Engine create() {
+        std::random_device device;
+        std::seed_seq seed{device(), device(), device(), device(), device(), device(), device(), device()};
+        return Engine(seed);
+    }
+};
+
+// Philox threads share one random key and take consecutive streams, which
+// guarantees disjoint sequences instead of relying on random seeds not colliding
+template<>
+struct ThreadEngineSeeder<Philox4x32x10> {
+    static Philox4x32x10 create() {
+        static const uint64_t key = [] {
+            std::random_device device;
+            return (uint64_t{device()} << 32) | device();
+        }();
+        static std::atomic<uint64_t> nextStream{0};
+        return Philox4x32x10(key, nextStream.fetch_add(1, std::memory_order_relaxed));
+    }
+};
+
+template<typename Engine>
+Engine& threadLocalEngine() {
+    static thread_local Engine engine = ThreadEngineSeeder<Engine>::create();
+    return engine;
+}
+
+// Fills words with 64-bit values; narrower engines are combined from two draws
+template<typename Engine>
+void fillRandomWords(Engine& engine, uint64_t* words, size_t n) {
+    static_assert(Engine::min() == 0, "Engine must produce values starting at 0");
+    if constexpr (Engine::max() == std::numeric_limits<uint64_t>::max()) {
+        for (size_t i = 0; i < n; i++) {
+            words[i] = engine();
+        }
+    } else {
+        static_assert(Engine::max() == std::numeric_limits<uint32_t>::max(),
+                      "Engine must produce 32 or 64 random bits per call");
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t high = engine();
+            words[i] = (high << 32) | static_cast<uint64_t>(engine());
+        }
+    }
+}
@@ -8,6 +8,12 @@
 #include <sqlite3.h>
 #include <stdexcept>
 #include <memory>
+#include <map>
+#include <utility>
+#include <chrono>
+#include <mutex>
+#include <cstdint>
+#include <string_view>
 
 // ============================================================================
 // Repository Pattern - Generic DAO Interface
@@ -18,6 +24,17 @@ class IRepository {
 public:
     virtual ~IRepository() = default;
     virtual std::optional<T> get(const std::string& id) = 0;
+
+    // Looks up several IDs at once; result i belongs to ids[i]. The default
+    // calls get() per ID, implementations override it to batch the lookups.
+    virtual std::vector<std::optional<T>> getMany(const std::vector<std::string>& ids) {
+        std::vector<std::optional<T>> results;
+        results.reserve(ids.size());
+        for (const auto& id : ids) {
+            results.push_back(get(id));
+        }
+        return results;
+    }
 };
 
 
@@ -48,7 +65,7 @@ public:
     VectorRepository(
         std::function<bool(const T&, const std::string&)> filter,
         const std::vector<T>& initialData = {}
-    ) : filterFn(filter), data(initialData) {}
+    ) : data(initialData), filterFn(filter) {}
 
     std::optional<T> get(const std::string& id) override {
         auto it = std::find_if(data.begin(), data.end(), [this, &id](const T& item) {
@@ -61,9 +78,124 @@ public:
         return std::nullopt;
     }
 
+    // getMany() stays the default get() per ID: filterFn only compares an
+    // item with one ID, so no single scan could avoid calling it per pair.
+    // IndexedVectorRepository extracts keys and answers each ID in O(1).
+
+    // Helper method to add data (useful for testing)
+    void add(const T& item) {
+        data.push_back(item);
+    }
+};
+
+// ============================================================================
+// Indexed Vector-based Repository Implementation
+// ============================================================================
+
+// Same contract as VectorRepository, but items are looked up by a key taken
+// from each item once on add(). An open-addressing hash index (linear probing,
+// load factor <= 1/2) maps keys to vector positions, so get() is O(1). As with
+// VectorRepository's find_if, the first item added with a given key wins.
+template<typename T>
+class IndexedVectorRepository : public IRepository<T> {
+private:
+    static constexpr uint32_t emptySlot = UINT32_MAX;
+
+    struct Slot {
+        uint64_t hash;
+        uint32_t index;
+    };
+
+    std::vector<T> data;
+    std::vector<std::string> keys;
+    std::vector<Slot> slots;
+    std::function<std::string(const T&)> keyFn;
+
+    static uint64_t hashKey(std::string_view key) {
+        return std::hash<std::string_view>{}(key);
+    }
+
+    // Position of the slot holding key, or of the free slot ending its probe sequence
+    size_t probe(std::string_view key, uint64_t hash) const {
+        const size_t mask = slots.size() - 1;
+        size_t position = static_cast<size_t>(hash) & mask;
+        while (slots[position].index != emptySlot) {
+            const Slot& slot = slots[position];
+            if (slot.hash == hash && keys[slot.index] == key) {
+                break;
+            }
+            position = (position + 1) & mask;
+        }
+        return position;
+    }
+
+    void rehash(size_t capacity) {
+        slots.assign(capacity, Slot{0, emptySlot});
+        for (size_t i = 0; i < data.size(); i++) {
+            index(static_cast<uint32_t>(i));
+        }
+    }
+
+    template<typename U>
+    static void reserveOneMore(std::vector<U>& items) {
+        if (items.size() == items.capacity()) {
+            items.reserve(items.empty() ? 16 : 2 * items.size());
+        }
+    }
+
+    void index(uint32_t itemIndex) {
+        const uint64_t hash = hashKey(keys[itemIndex]);
+        Slot& slot = slots[probe(keys[itemIndex], hash)];
+        if (slot.index == emptySlot) {
+            slot = Slot{hash, itemIndex};
+        }
+    }
+
+public:
+    // Constructor with key extractor and optional initial data
+    IndexedVectorRepository(
+        std::function<std::string(const T&)> keyExtractor,
+        const std::vector<T>& initialData = {}
+    ) : keyFn(keyExtractor) {
+        data.reserve(initialData.size());
+        keys.reserve(initialData.size());
+        slots.assign(16, Slot{0, emptySlot});
+        for (const auto& item : initialData) {
+            add(item);
+        }
+    }
+
+    std::optional<T> get(const std::string& id) override {
+        const Slot& slot = slots[probe(id, hashKey(id))];
+        if (slot.index != emptySlot) {
+            return data[slot.index];
+        }
+        return std::nullopt;
+    }
+
     // Helper method to add data (useful for testing)
     void add(const T& item) {
+        if (data.size() >= emptySlot) {
+            throw RepositoryException("Repository is full");
+        }
+        // Take the key and make room first, so a throwing keyFn or allocation
+        // leaves data and keys the same length
+        std::string key = keyFn(item);
+        reserveOneMore(data);
+        reserveOneMore(keys);
         data.push_back(item);
+        keys.push_back(std::move(key));
+        if (2 * data.size() > slots.size()) {
+            try {
+                rehash(2 * slots.size());
+            } catch (...) {
+                data.pop_back();
+                keys.pop_back();
+                throw;
+            }
+        } else {
+            index(static_cast<uint32_t>(data.size() - 1));
+        }
     }
 };
 
@@ -79,6 +211,46 @@ public:
 // SQLite-based Repository Implementation
 // ============================================================================
 
+struct BulkInsertResult {
+    size_t rows;
+    std::chrono::nanoseconds elapsed;
+
+    double rowsPerSecond() const {
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        return seconds > 0 ? static_cast<double>(rows) / seconds : 0.0;
+    }
+};
+
+// Read-only view of the current result row. The text it returns points into
+// SQLite's buffers and is only valid while the withRow() callback runs.
+class SqliteRowView {
+private:
+    sqlite3_stmt* stmt;
+
+public:
+    explicit SqliteRowView(sqlite3_stmt* statement) : stmt(statement) {}
+
+    int columnCount() const {
+        return sqlite3_column_count(stmt);
+    }
+
+    bool isNull(int column) const {
+        return sqlite3_column_type(stmt, column) == SQLITE_NULL;
+    }
+
+    std::string_view text(int column) const {
+        const auto* data = reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+        if (!data) {
+            return {};
+        }
+        return std::string_view(data, static_cast<size_t>(sqlite3_column_bytes(stmt, column)));
+    }
+
+    int64_t integer(int column) const {
+        return sqlite3_column_int64(stmt, column);
+    }
+};
+
 template<typename T>
 class SqliteRepository : public IRepository<T> {
 private:
@@ -88,14 +260,98 @@ private:
     std::string colName;
     bool ownsDb;
 
-    void checkSqliteError(int result, const std::string& operation) {
+    // Statements are prepared on first use and reused via sqlite3_reset;
+    // mutex serializes all use of the connection and its statements. They
+    // keep a connection the repository doesn't own from closing, see release()
+    std::string selectSql;
+    std::string insertSql;
+    sqlite3_stmt* selectStmt = nullptr;
+    sqlite3_stmt* insertStmt = nullptr;
+    std::map<size_t, sqlite3_stmt*> selectManyStmts;
+    std::vector<std::string> projectionSqls;
+    std::vector<sqlite3_stmt*> projectionStmts;
+    std::mutex mutex;
+
+    static constexpr size_t minInListSize = 8;
+    static constexpr size_t maxInListSize = 512;
+
+    // operation is a C string so that the success path does not allocate
+    void checkSqliteError(int result, const char* operation) {
         if (result != SQLITE_OK && result != SQLITE_DONE && result != SQLITE_ROW) {
-            std::string errorMsg = operation + ": " + sqlite3_errmsg(db);
+            std::string errorMsg = std::string(operation) + ": " + sqlite3_errmsg(db);
             throw std::runtime_error(errorMsg);
         }
     }
 
+    sqlite3_stmt* cachedStatement(sqlite3_stmt*& stmt, const std::string& sql, const char* operation) {
+        if (!stmt) {
+            int result = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+            checkSqliteError(result, operation);
+        }
+        return stmt;
+    }
+
+    // Returns a cached statement to its initial state when leaving scope,
+    // including when the step, the binder or the mapper throws
+    struct StatementReset {
+        sqlite3_stmt* stmt;
+
+        ~StatementReset() {
+            sqlite3_reset(stmt);
+            sqlite3_clear_bindings(stmt);
+        }
+    };
+
+    // "SELECT *, col ... WHERE col IN (?, ...)" for a power-of-two number of
+    // placeholders; unused ones are bound to NULL, which never matches. The
+    // key comes last, so the row mapper sees the same columns as in get().
+    sqlite3_stmt* selectManyStatement(size_t placeholders) {
+        sqlite3_stmt*& stmt = selectManyStmts[placeholders];
+        if (!stmt) {
+            std::string sql = "SELECT *, " + colName + " FROM " + tableName + " WHERE " + colName + " IN (?";
+            for (size_t i = 1; i < placeholders; i++) {
+                sql += ", ?";
+            }
+            sql += ")";
+            return cachedStatement(stmt, sql, "prepare statement");
+        }
+        return stmt;
+    }
+
+    // Steps stmt for id and passes the row to callback. Database errors become
+    // RepositoryException, exceptions from callback propagate unchanged.
+    template<typename Callback>
+    bool readRow(sqlite3_stmt*& stmt, const std::string& sql, std::string_view id, Callback& callback) {
+        sqlite3_stmt* statement;
+        try {
+            statement = cachedStatement(stmt, sql, "prepare statement");
+        }
+        catch (...) {
+            throw RepositoryException("Database error");
+        }
+        StatementReset reset{statement};
+
+        const char* text = id.data() ? id.data() : "";
+        if (sqlite3_bind_text(statement, 1, text, static_cast<int>(id.size()), SQLITE_STATIC) != SQLITE_OK) {
+            throw RepositoryException("Database error");
+        }
+        const int result = sqlite3_step(statement);
+        if (result == SQLITE_ROW) {
+            callback(SqliteRowView(statement));
+            return true;
+        }
+        if (result != SQLITE_DONE) {
+            throw RepositoryException("Database error");
+        }
+        return false;
+    }
+
 public:
+    // Handle for a column projection, see prepareProjection()
+    struct Projection {
+        size_t index;
+    };
+
     // Constructor with database connection and mappers
     SqliteRepository(
         sqlite3* database,
@@ -103,27 +359,48 @@ public:
         std::function<T(sqlite3_stmt*)> mapper,
         std::string columnName,
         bool takeOwnership = false
-    ) : db(database), tableName(table), rowMapper(mapper), colName(columnName), ownsDb(takeOwnership) {}
+    ) : db(database), tableName(table), rowMapper(mapper), colName(columnName), ownsDb(takeOwnership),
+        selectSql("SELECT * FROM " + table + " WHERE " + columnName + " = ?"),
+        insertSql("INSERT INTO " + table + " VALUES (?, ?, ?, ?)") {}
 
     ~SqliteRepository() {
+        release();
         if (ownsDb && db) {
             sqlite3_close(db);
         }
     }
 
+    // Finalizes the cached statements. sqlite3_close() fails with SQLITE_BUSY
+    // while any are left, so a connection the repository doesn't own can only
+    // be closed after the repository is destroyed or after this call. Later
+    // calls prepare the statements again; projections stay valid.
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex);
+        sqlite3_finalize(selectStmt);
+        selectStmt = nullptr;
+        sqlite3_finalize(insertStmt);
+        insertStmt = nullptr;
+        for (auto& entry : selectManyStmts) {
+            sqlite3_finalize(entry.second);
+        }
+        selectManyStmts.clear();
+        for (sqlite3_stmt*& stmt : projectionStmts) {
+            sqlite3_finalize(stmt);
+            stmt = nullptr;
+        }
+    }
+
     // Delete copy constructor and assignment
     SqliteRepository(const SqliteRepository&) = delete;
     SqliteRepository& operator=(const SqliteRepository&) = delete;
 
     std::optional<T> get(const std::string& id) override {
+        std::lock_guard<std::mutex> lock(mutex);
         try {
-            std::string sql = "SELECT * FROM " + tableName + " WHERE " + colName + " = ?";
-            sqlite3_stmt* stmt;
-    
-            int result = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
-            checkSqliteError(result, "prepare statement");
+            sqlite3_stmt* stmt = cachedStatement(selectStmt, selectSql, "prepare statement");
+            StatementReset reset{stmt};
     
-            result = sqlite3_bind_text(stmt, 1, id.c_str(), -1, SQLITE_TRANSIENT);
+            int result = sqlite3_bind_text(stmt, 1, id.c_str(), static_cast<int>(id.size()), SQLITE_STATIC);
             checkSqliteError(result, "bind parameter");
     
             std::optional<T> returnValue = std::nullopt;
@@ -135,7 +412,6 @@ public:
                 checkSqliteError(result, "execute query");
             }
     
-            sqlite3_finalize(stmt);
             return returnValue;
         } 
         catch (...) {
@@ -143,19 +419,168 @@ public:
         }
     }
 
+    // Calls callback with a view of the matching row instead of mapping it to
+    // a T. Nothing is copied: with the cached statement and the ID bound in
+    // place, a lookup makes no heap allocations. Returns false if not found.
+    template<typename Callback>
+    bool withRow(std::string_view id, Callback&& callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return readRow(selectStmt, selectSql, id, callback);
+    }
+
+    // Prepares "SELECT <columns> FROM table WHERE col = ?" for use with
+    // withRow(projection, ...); view column i is columns[i]. Column names are
+    // pasted into the SQL like the table and key column, so they must be trusted.
+    Projection prepareProjection(const std::vector<std::string>& columns) {
+        std::string sql = "SELECT ";
+        for (size_t i = 0; i < columns.size(); i++) {
+            sql += (i > 0 ? ", " : "") + columns[i];
+        }
+        sql += " FROM " + tableName + " WHERE " + colName + " = ?";
+
+        std::lock_guard<std::mutex> lock(mutex);
+        sqlite3_stmt* stmt = nullptr;
+        try {
+            cachedStatement(stmt, sql, "prepare projection");
+        }
+        catch (...) {
+            throw RepositoryException("Database error");
+        }
+        projectionSqls.push_back(sql);
+        projectionStmts.push_back(stmt);
+        return Projection{projectionStmts.size() - 1};
+    }
+
+    // Undoes the latest prepareProjection(), e.g. when a pool couldn't prepare
+    // it on every connection. Only the latest projection can be discarded.
+    void discardProjection(Projection projection) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (projection.index + 1 != projectionStmts.size()) {
+            throw std::logic_error("Only the latest projection can be discarded");
+        }
+        sqlite3_finalize(projectionStmts.back());
+        projectionStmts.pop_back();
+        projectionSqls.pop_back();
+    }
+
+    template<typename Callback>
+    bool withRow(Projection projection, std::string_view id, Callback&& callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return readRow(projectionStmts.at(projection.index), projectionSqls.at(projection.index), id, callback);
+    }
+
+    // Looks IDs up in chunks of up to maxInListSize with one IN (...) query each
+    std::vector<std::optional<T>> getMany(const std::vector<std::string>& ids) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        try {
+            std::vector<std::optional<T>> results(ids.size());
+
+            // (ID, position) sorted by ID, to map result rows back to positions
+            std::vector<std::pair<std::string_view, size_t>> byId(ids.size());
+            for (size_t i = 0; i < ids.size(); i++) {
+                byId[i] = {ids[i], i};
+            }
+            std::sort(byId.begin(), byId.end());
+            const auto idLess = [](const auto& a, const auto& b) { return a.first < b.first; };
+
+            for (size_t chunkStart = 0; chunkStart < ids.size(); chunkStart += maxInListSize) {
+                const size_t chunkSize = std::min(maxInListSize, ids.size() - chunkStart);
+                size_t placeholders = minInListSize;
+                while (placeholders < chunkSize) {
+                    placeholders *= 2;
+                }
+
+                sqlite3_stmt* stmt = selectManyStatement(placeholders);
+                StatementReset reset{stmt};
+                for (size_t i = 0; i < chunkSize; i++) {
+                    const std::string& id = ids[chunkStart + i];
+                    int result = sqlite3_bind_text(stmt, static_cast<int>(i + 1), id.c_str(), static_cast<int>(id.size()), SQLITE_STATIC);
+                    checkSqliteError(result, "bind parameter");
+                }
+
+                const int keyColumn = sqlite3_column_count(stmt) - 1;
+                int result;
+                while ((result = sqlite3_step(stmt)) == SQLITE_ROW) {
+                    const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, keyColumn));
+                    const std::string_view key(text ? text : "", static_cast<size_t>(sqlite3_column_bytes(stmt, keyColumn)));
+                    auto range = std::equal_range(byId.begin(), byId.end(), std::make_pair(key, size_t{0}), idLess);
+                    const T* mapped = nullptr;
+                    for (auto entry = range.first; entry != range.second; ++entry) {
+                        auto& slot = results[entry->second];
+                        if (!slot) {
+                            slot = mapped ? *mapped : rowMapper(stmt);
+                            mapped = &*slot;
+                        }
+                    }
+                }
+                checkSqliteError(result, "execute query");
+            }
+            return results;
+        }
+        catch (...) {
+            throw RepositoryException("Database error");
+        }
+    }
+
     // Helper method to insert data
     void insert(const T& item, std::function<void(sqlite3_stmt*, const T&)> binder) {
-        std::string sql = "INSERT INTO " + tableName + " VALUES (?, ?, ?, ?)";
-        sqlite3_stmt* stmt;
-
-        int result = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
-        checkSqliteError(result, "prepare insert");
+        std::lock_guard<std::mutex> lock(mutex);
+        sqlite3_stmt* stmt = cachedStatement(insertStmt, insertSql, "prepare insert");
+        StatementReset reset{stmt};
 
         binder(stmt, item);
 
-        result = sqlite3_step(stmt);
+        int result = sqlite3_step(stmt);
         checkSqliteError(result, "execute insert");
+    }
+
+    // Inserts all items with the cached INSERT, committing every batchSize
+    // rows. Batches are savepoints, so this also works inside a transaction
+    // opened by the caller. On error the current batch is rolled back, earlier
+    // batches stay committed, and the exception is rethrown.
+    template<typename Range>
+    BulkInsertResult insertMany(
+        const Range& items,
+        std::function<void(sqlite3_stmt*, const T&)> binder,
+        size_t batchSize = 1000
+    ) {
+        if (batchSize == 0) {
+            throw std::invalid_argument("batchSize must be at least 1");
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto start = std::chrono::steady_clock::now();
+        sqlite3_stmt* stmt = cachedStatement(insertStmt, insertSql, "prepare insert");
+
+        size_t rows = 0;
+        size_t rowsInBatch = 0;
+        try {
+            for (const T& item : items) {
+                if (rowsInBatch == 0) {
+                    checkSqliteError(sqlite3_exec(db, "SAVEPOINT insert_many", nullptr, nullptr, nullptr), "begin batch");
+                }
+                {
+                    StatementReset reset{stmt};
+                    binder(stmt, item);
+                    checkSqliteError(sqlite3_step(stmt), "execute insert");
+                }
+                rows++;
+                if (++rowsInBatch == batchSize) {
+                    checkSqliteError(sqlite3_exec(db, "RELEASE insert_many", nullptr, nullptr, nullptr), "commit batch");
+                    rowsInBatch = 0;
+                }
+            }
+            if (rowsInBatch > 0) {
+                checkSqliteError(sqlite3_exec(db, "RELEASE insert_many", nullptr, nullptr, nullptr), "commit batch");
+                rowsInBatch = 0;
+            }
+        }
+        catch (...) {
+            if (rowsInBatch > 0) {
+                sqlite3_exec(db, "ROLLBACK TO insert_many; RELEASE insert_many", nullptr, nullptr, nullptr);
+            }
+            throw;
+        }
 
-        sqlite3_finalize(stmt);
+        return {rows, std::chrono::steady_clock::now() - start};
     }
 };
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "uss.h"
+
+// ============================================================================
+// Hierarchical Timing Wheel
+// ============================================================================
+
+// Schedules keys for expiry at a tick. Four levels of 64 slots cover 64^4
+// ticks; level l holds deadlines 64^l .. 64^(l+1) ticks ahead and is cascaded
+// into the level below when the lower levels wrap, so schedule() and each
+// tick of advance() are O(1) amortized. Later deadlines are clamped to the
+// last level's range.
+//
+// Nothing is ever unscheduled: the owner checks each expired key against its
+// own record and ignores stale ones.
+class TimingWheel {
+public:
+    struct Timer {
+        std::string key;
+        uint64_t deadline;
+    };
+
+    static constexpr int levels = 4;
+    static constexpr int slotBits = 6;
+    static constexpr size_t slotsPerLevel = size_t{1} << slotBits;
+
+    explicit TimingWheel(uint64_t startTick = 0) : current(startTick) {}
+
+    void schedule(std::string key, uint64_t deadline);
+
+    // Processes every tick up to and including now, calling onExpired(timer)
+    // for each timer whose deadline has been reached
+    void advance(uint64_t now, const std::function<void(const Timer&)>& onExpired);
+
+    // Removes timers, roughly earliest deadline first, until accept() returns
+    // true for one and returns that one. Exact within a slot and across level
+    // 0; a higher level's slot may hold a deadline just below one in level 0.
+    // Used to evict a session that would expire soon.
+    std::optional<Timer> popFirst(const std::function<bool(const Timer&)>& accept);
+
+    // Drops every timer keep() returns false for
+    void compact(const std::function<bool(const Timer&)>& keep);
+
+    // The next tick advance() will process
+    uint64_t tick() const {
+        return current;
+    }
+
+    size_t scheduled() const {
+        return count;
+    }
+
+private:
+    uint64_t current;
+    size_t count = 0;
+    std::array<std::array<std::vector<Timer>, slotsPerLevel>, levels> wheel;
+
+    void place(Timer timer);
+    void cascade(int level);
+};
+
+// ============================================================================
+// Session Store - sharded concurrent map with timing-wheel expiry
+// ============================================================================
+
+struct SessionStoreOptions {
+    size_t maxSessions = 1000000;                    // over all shards
+    size_t shardCount = 64;
+    std::chrono::milliseconds ttl{30 * 60 * 1000};
+    std::chrono::milliseconds tick{1000};            // expiry resolution
+};
+
+// Keeps sessions by Session::sessionId. Lookups take a shard's shared lock,
+// so concurrent validations of different (or the same) sessions don't block
+// each other; writes take the shard's exclusive lock and advance its timing
+// wheel, which drops expired sessions in O(1) per session.
+//
+// get() never returns an expired session, even before the wheel has caught
+// up. Call expire() periodically to reclaim memory of shards that see no
+// writes.
+//
+// Each shard holds at most maxSessions / shardCount sessions; adding to a
+// full shard evicts one of its sessions closest to expiry. Refreshed and
+// removed sessions leave their old timer in the wheel; once a shard's wheel
+// holds more than twice as many timers as sessions (plus compactionSlack),
+// the stale ones are dropped, so memory stays bounded by maxSessions too.
+class SessionStore {
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    static constexpr size_t compactionSlack = 64;
+
+    explicit SessionStore(SessionStoreOptions storeOptions = {}, Clock now = steadyNow);
+
+    // Adds or replaces the session and (re)starts its ttl
+    void put(const Session& session);
+
+    std::optional<Session> get(std::string_view sessionId) const;
+    bool contains(std::string_view sessionId) const;
+    bool remove(std::string_view sessionId);
+
+    // Advances every shard's wheel to now
+    void expire();
+
+    // Sessions held, including expired ones not yet reclaimed
+    size_t size() const;
+
+    // Timers in the shards' wheels, including stale ones
+    size_t scheduled() const;
+
+    size_t capacity() const {
+        return shardCapacity * shards.size();
+    }
+
+private:
+    struct Entry {
+        Session session;
+        uint64_t expiresAt;   // tick
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, Entry> sessions;
+        TimingWheel wheel;
+
+        explicit Shard(uint64_t startTick) : wheel(startTick) {}
+    };
+
+    SessionStoreOptions options;
+    Clock clock;
+    std::chrono::steady_clock::time_point origin;
+    size_t shardCapacity;
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    static std::chrono::steady_clock::time_point steadyNow() {
+        return std::chrono::steady_clock::now();
+    }
+
+    uint64_t currentTick() const;
+    Shard& shardFor(std::string_view sessionId) const;
+
+    // Called with the shard locked exclusively
+    void advance(Shard& shard, uint64_t now);
+    void evictOne(Shard& shard);
+    void compactIfStale(Shard& shard);
+};
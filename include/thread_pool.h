@@ -0,0 +1,72 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// ============================================================================
+// Thread Pool - fixed workers with a bounded task queue
+// ============================================================================
+
+// submit() blocks while the queue is full, which pushes back on producers
+// instead of letting the backlog grow without limit; trySubmit() returns
+// nullopt instead. Exceptions thrown by a task are stored in its future.
+//
+// The destructor stops accepting work, runs the tasks already queued and
+// joins the workers.
+class ThreadPool {
+public:
+    ThreadPool(size_t threadCount, size_t queueCapacity);
+    ~ThreadPool();
+
+    // Delete copy constructor and assignment
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template<typename Fn>
+    auto submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+        auto task = makeTask(std::forward<Fn>(fn));
+        auto result = task->get_future();
+        enqueue([task] { (*task)(); }, true);
+        return result;
+    }
+
+    template<typename Fn>
+    auto trySubmit(Fn&& fn) -> std::optional<std::future<std::invoke_result_t<std::decay_t<Fn>>>> {
+        auto task = makeTask(std::forward<Fn>(fn));
+        auto result = task->get_future();
+        if (!enqueue([task] { (*task)(); }, false)) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    size_t threadCount() const;
+    size_t queueCapacity() const;
+    size_t queued();
+
+private:
+    size_t capacity;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable spaceAvailable;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    template<typename Fn>
+    static auto makeTask(Fn&& fn) {
+        using Result = std::invoke_result_t<std::decay_t<Fn>>;
+        return std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+    }
+
+    bool enqueue(std::function<void()> task, bool wait);
+    void workerLoop();
+};
@@ -1,24 +1,60 @@
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <vector>
 #include "repository.h"
 
+// ============================================================================
+// Allocator-aware request types
+// ============================================================================
+
+// Person, Credentials and ValidationError keep their strings in std::pmr
+// containers, so a per-request arena (e.g. std::pmr::monotonic_buffer_resource)
+// can back all of them. They follow the uses-allocator protocol, so pmr
+// containers pass their allocator down to the elements.
+//
+// Plain copies use the default resource, not the source's arena, so a copy
+// can safely outlive the request that built the original.
+using RequestAllocator = std::pmr::polymorphic_allocator<char>;
+
 struct ValidationError {
-    std::string field;
-    std::string message;
+    using allocator_type = RequestAllocator;
+
+    std::pmr::string field;
+    std::pmr::string message;
+
+    ValidationError() = default;
+    explicit ValidationError(const allocator_type& alloc) : field(alloc), message(alloc) {}
+    ValidationError(std::string_view field, std::string_view message, const allocator_type& alloc = {})
+        : field(field, alloc), message(message, alloc) {}
+    ValidationError(const ValidationError&) = default;
+    ValidationError(ValidationError&&) = default;
+    ValidationError(const ValidationError& other, const allocator_type& alloc)
+        : field(other.field, alloc), message(other.message, alloc) {}
+    ValidationError(ValidationError&& other, const allocator_type& alloc)
+        : field(std::move(other.field), alloc), message(std::move(other.message), alloc) {}
+    ValidationError& operator=(const ValidationError&) = default;
+    ValidationError& operator=(ValidationError&&) = default;
+
+    allocator_type get_allocator() const {
+        return field.get_allocator();
+    }
 };
 
+// Copies the errors to the default resource, since the exception outlives
+// the request arena they may have been built in
 class ValidationException : public std::exception {
 private:
-    std::vector<ValidationError> errors;
+    std::pmr::vector<ValidationError> errors;
     mutable std::string message;
 
 public:
-    explicit ValidationException(const std::vector<ValidationError>& errors) : errors(errors) {}
+    explicit ValidationException(const std::pmr::vector<ValidationError>& errors) : errors(errors) {}
 
-    const std::vector<ValidationError>& getErrors() const {
+    const std::pmr::vector<ValidationError>& getErrors() const {
         return errors;
     }
 
@@ -33,6 +69,44 @@ public:
     }
 };
 
+// Non-throwing outcome of a validation: the sanitized value, or the errors
+// that were found. Both are built with the allocator of the input, so a
+// rejected request costs no more than an accepted one.
+template<typename T>
+class ValidationResult {
+private:
+    T sanitized;
+    std::pmr::vector<ValidationError> errorList;
+
+public:
+    explicit ValidationResult(const RequestAllocator& alloc = {}) : sanitized(alloc), errorList(alloc) {}
+
+    bool ok() const {
+        return errorList.empty();
+    }
+
+    explicit operator bool() const {
+        return ok();
+    }
+
+    // Only meaningful when ok()
+    T& value() {
+        return sanitized;
+    }
+
+    const T& value() const {
+        return sanitized;
+    }
+
+    std::pmr::vector<ValidationError>& errors() {
+        return errorList;
+    }
+
+    const std::pmr::vector<ValidationError>& errors() const {
+        return errorList;
+    }
+};
+
 class ServerException : public std::exception {
 private:
     std::string message;
@@ -57,28 +131,80 @@ public:
     }
 };
 
-std::string sanitizeAndValidateEmail(const std::string& email);
-std::string sanitizeAndValidatePassword(const std::string& password);
+// The result is allocated with alloc
+std::pmr::string sanitizeAndValidateEmail(std::string_view email, const RequestAllocator& alloc = {});
+std::pmr::string sanitizeAndValidatePassword(std::string_view password, const RequestAllocator& alloc = {});
+
+// Non-throwing variants: write the sanitized value to out and return nullptr,
+// or return a static error message and leave out unspecified
+const char* trySanitizeAndValidateEmail(std::string_view email, std::pmr::string& out);
+const char* trySanitizeAndValidatePassword(std::string_view password, std::pmr::string& out);
 
 // Forward declaration
 struct Credentials;
 
+// The result and its error list use the allocator of credentials
+ValidationResult<Credentials> validateCredentials(const Credentials& credentials);
+
+// Throwing wrapper over validateCredentials
 Credentials sanitizeAndValidateCredentials(const Credentials& credentials);
 
 struct Person {
-    std::string id;
-    std::string email;
-    std::string passwordHash;
-    std::string status;
+    using allocator_type = RequestAllocator;
+
+    std::pmr::string id;
+    std::pmr::string email;
+    std::pmr::string passwordHash;
+    std::pmr::string status;
+
+    Person() = default;
+    explicit Person(const allocator_type& alloc) : id(alloc), email(alloc), passwordHash(alloc), status(alloc) {}
+    Person(std::string_view id, std::string_view email, std::string_view passwordHash, std::string_view status,
+           const allocator_type& alloc = {})
+        : id(id, alloc), email(email, alloc), passwordHash(passwordHash, alloc), status(status, alloc) {}
+    Person(const Person&) = default;
+    Person(Person&&) = default;
+    Person(const Person& other, const allocator_type& alloc)
+        : id(other.id, alloc), email(other.email, alloc),
+          passwordHash(other.passwordHash, alloc), status(other.status, alloc) {}
+    Person(Person&& other, const allocator_type& alloc)
+        : id(std::move(other.id), alloc), email(std::move(other.email), alloc),
+          passwordHash(std::move(other.passwordHash), alloc), status(std::move(other.status), alloc) {}
+    Person& operator=(const Person&) = default;
+    Person& operator=(Person&&) = default;
+
+    allocator_type get_allocator() const {
+        return id.get_allocator();
+    }
 };
 
 struct Credentials {
-    std::string email;
-    std::string plainPassword;
+    using allocator_type = RequestAllocator;
+
+    std::pmr::string email;
+    std::pmr::string plainPassword;
+
+    Credentials() = default;
+    explicit Credentials(const allocator_type& alloc) : email(alloc), plainPassword(alloc) {}
+    Credentials(std::string_view email, std::string_view plainPassword, const allocator_type& alloc = {})
+        : email(email, alloc), plainPassword(plainPassword, alloc) {}
+    Credentials(const Credentials&) = default;
+    Credentials(Credentials&&) = default;
+    Credentials(const Credentials& other, const allocator_type& alloc)
+        : email(other.email, alloc), plainPassword(other.plainPassword, alloc) {}
+    Credentials(Credentials&& other, const allocator_type& alloc)
+        : email(std::move(other.email), alloc), plainPassword(std::move(other.plainPassword), alloc) {}
+    Credentials& operator=(const Credentials&) = default;
+    Credentials& operator=(Credentials&&) = default;
+
+    allocator_type get_allocator() const {
+        return email.get_allocator();
+    }
 };
 
 struct Session {
     std::string userId;
+    std::string sessionId;
 };
 
 // Type alias for Person repository
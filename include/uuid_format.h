@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ============================================================================
+// UUID Format Policies
+// ============================================================================
+
+// Compile-time formatting policy: the case and the dash layout are template
+// parameters, so encoding an ID has no per-character branches.
+template<bool UpperCase, bool Dashes>
+struct UuidFormat {
+    static constexpr bool upperCase = UpperCase;
+    static constexpr bool dashes = Dashes;
+    static constexpr size_t length = Dashes ? 36 : 32;
+};
+
+using UuidFormatLower = UuidFormat<false, false>;
+using UuidFormatUpper = UuidFormat<true, false>;
+using UuidFormatLowerDashed = UuidFormat<false, true>;
+using UuidFormatUpperDashed = UuidFormat<true, true>;
+
+// ============================================================================
+// Table-based hex encoding
+// ============================================================================
+
+// Two hex chars per byte value, so each byte is encoded with a single lookup
+struct HexByteTable {
+    std::array<char, 512> chars{};
+
+    constexpr explicit HexByteTable(bool upperCase) {
+        const char* digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+        for (int i = 0; i < 256; i++) {
+            chars[2 * i] = digits[i >> 4];
+            chars[2 * i + 1] = digits[i & 0x0f];
+        }
+    }
+};
+
+template<bool UpperCase>
+inline constexpr HexByteTable hexByteTable{UpperCase};
+
+// Output offset of each of the 16 bytes: 8-4-4-4-12 with dashes, packed without
+template<bool Dashes>
+inline constexpr std::array<uint8_t, 16> uuidByteOffsets = Dashes
+    ? std::array<uint8_t, 16>{0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34}
+    : std::array<uint8_t, 16>{0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+
+// Writes Format::length chars for the 16 bytes to out (no terminating null)
+template<typename Format>
+inline void formatUuid(const uint8_t* bytes, char* out) {
+    const auto& table = hexByteTable<Format::upperCase>.chars;
+    const auto& offsets = uuidByteOffsets<Format::dashes>;
+    for (size_t i = 0; i < 16; i++) {
+        std::memcpy(out + offsets[i], &table[2 * bytes[i]], 2);
+    }
+    if constexpr (Format::dashes) {
+        out[8] = '-';
+        out[13] = '-';
+        out[18] = '-';
+        out[23] = '-';
+    }
+}
+
+// Big-endian byte order, so the hex string reads like the word in hex
+inline void storeBigEndian(uint64_t word, uint8_t* bytes) {
+    for (int i = 0; i < 8; i++) {
+        bytes[i] = static_cast<uint8_t>(word >> (56 - 8 * i));
+    }
+}
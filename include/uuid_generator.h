@@ -1,6 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <utility>
+#include <vector>
+#include <random>
+#include "random_engines.h"
+#include "uuid_format.h"
 
 // ============================================================================
 // UUID Generator Interface
@@ -10,6 +21,16 @@ class UuidGenerator {
 public:
     virtual ~UuidGenerator() = default;
     virtual std::string create() = 0;
+
+    // Number of characters per ID written by createInto()
+    virtual size_t length() const { return 32; }
+
+    // Writes n IDs back to back into out, which must hold n * length() chars
+    // (no separators, no terminating null). The default falls back to create()
+    // and throws std::length_error if an ID isn't length() characters long.
+    virtual void createInto(char* out, size_t n);
+
+    std::vector<std::string> createBatch(size_t n);
 };
 
 // ============================================================================
@@ -23,3 +44,146 @@ public:
 protected:
     virtual std::string createOne();
 };
+
+// ============================================================================
+// Random Implementation - 64-bit draws, table-based hex encoding
+// ============================================================================
+
+class UuidGeneratorRandomImpl : public UuidGenerator {
+public:
+    std::string create() override;
+    void createInto(char* out, size_t n) override;
+};
+
+// ============================================================================
+// RFC 4122 Version 4 (random) Implementation
+// ============================================================================
+
+// Engine is any 32- or 64-bit UniformRandomBitGenerator, e.g. std::mt19937_64,
+// Xoshiro256StarStar or Philox4x32x10; each thread uses its own instance
+template<typename Format = UuidFormatLower, typename Engine = std::mt19937_64>
+class UuidGeneratorV4 : public UuidGenerator {
+public:
+    std::string create() override {
+        std::string id(Format::length, '\0');
+        createInto(id.data(), 1);
+        return id;
+    }
+
+    size_t length() const override { return Format::length; }
+
+    void createInto(char* out, size_t n) override {
+        auto& engine = threadLocalEngine<Engine>();
+        uint64_t words[2];
+        uint8_t bytes[16];
+        for (size_t i = 0; i < n; i++) {
+            fillRandomWords(engine, words, 2);
+            storeBigEndian(words[0], bytes);
+            storeBigEndian(words[1], bytes + 8);
+            bytes[6] = static_cast<uint8_t>((bytes[6] & 0x0f) | 0x40);  // version 4
+            bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3f) | 0x80);  // RFC 4122 variant
+            formatUuid<Format>(bytes, out);
+            out += Format::length;
+        }
+    }
+};
+
+// ============================================================================
+// RFC 4122 Version 4 from the operating system's CSPRNG
+// ============================================================================
+
+// Fills out with n bytes from getrandom() on Linux, /dev/urandom elsewhere.
+// Throws std::system_error if the source fails rather than returning weak bytes.
+void fillSecureRandom(uint8_t* out, size_t n);
+
+// Same IDs as UuidGeneratorV4, but unpredictable from earlier ones, so they
+// can be used as bearer tokens such as session IDs. Costs a system call per
+// 16 IDs instead of a few engine steps each.
+template<typename Format = UuidFormatLower>
+class UuidGeneratorSecureV4 : public UuidGenerator {
+public:
+    std::string create() override {
+        std::string id(Format::length, '\0');
+        createInto(id.data(), 1);
+        return id;
+    }
+
+    size_t length() const override { return Format::length; }
+
+    void createInto(char* out, size_t n) override {
+        uint8_t bytes[16 * 16];
+        while (n > 0) {
+            const size_t count = std::min<size_t>(n, 16);
+            fillSecureRandom(bytes, 16 * count);
+            for (size_t i = 0; i < count; i++) {
+                uint8_t* id = bytes + 16 * i;
+                id[6] = static_cast<uint8_t>((id[6] & 0x0f) | 0x40);  // version 4
+                id[8] = static_cast<uint8_t>((id[8] & 0x3f) | 0x80);  // RFC 4122 variant
+                formatUuid<Format>(id, out);
+                out += Format::length;
+            }
+            n -= count;
+        }
+    }
+};
+
+// ============================================================================
+// Version 7 (time-ordered) Implementation
+// ============================================================================
+
+// 48-bit Unix millisecond timestamp followed by a 12-bit sequence and 62
+// random bits. IDs from one generator are strictly increasing, so they are
+// appended at the right edge of a B-tree index instead of scattered.
+template<typename Format = UuidFormatLower, typename Engine = std::mt19937_64>
+class UuidGeneratorV7 : public UuidGenerator {
+private:
+    std::function<uint64_t()> clock;
+    // (timestamp << 12) | sequence of the last issued ID
+    std::atomic<uint64_t> lastTick{0};
+
+    uint64_t nextTick() {
+        const uint64_t now = clock() << 12;
+        uint64_t previous = lastTick.load(std::memory_order_relaxed);
+        uint64_t next;
+        do {
+            // Same millisecond (or clock went back): bump the sequence, which
+            // carries into the timestamp when it overflows
+            next = std::max(now, previous + 1);
+        } while (!lastTick.compare_exchange_weak(previous, next, std::memory_order_relaxed));
+        return next;
+    }
+
+public:
+    static uint64_t systemClockMillis() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    explicit UuidGeneratorV7(std::function<uint64_t()> millisClock = systemClockMillis)
+        : clock(std::move(millisClock)) {}
+
+    std::string create() override {
+        std::string id(Format::length, '\0');
+        createInto(id.data(), 1);
+        return id;
+    }
+
+    size_t length() const override { return Format::length; }
+
+    void createInto(char* out, size_t n) override {
+        auto& engine = threadLocalEngine<Engine>();
+        uint8_t bytes[16];
+        for (size_t i = 0; i < n; i++) {
+            uint64_t random;
+            fillRandomWords(engine, &random, 1);
+            const uint64_t tick = nextTick();
+            storeBigEndian(tick << 4, bytes);  // timestamp in bytes 0-5
+            storeBigEndian(random, bytes + 8);
+            bytes[6] = static_cast<uint8_t>(0x70 | ((tick >> 8) & 0x0f));  // version 7
+            bytes[7] = static_cast<uint8_t>(tick);
+            bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3f) | 0x80);  // RFC 4122 variant
+            formatUuid<Format>(bytes, out);
+            out += Format::length;
+        }
+    }
+};
@@ -0,0 +1,402 @@
+#include "big_unsigned.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+using Limbs = std::vector<uint64_t>;
+using u128 = unsigned __int128;
+
+constexpr uint64_t tenPow19 = 10000000000000000000ULL;
+constexpr int digitsPerLimb = 19;
+
+void trimLimbs(Limbs& x) {
+    while (!x.empty() && x.back() == 0) {
+        x.pop_back();
+    }
+}
+
+// out[0, na + nb) = a * b; out must not alias a or b
+void multiplySchoolbookInto(const uint64_t* a, size_t na, const uint64_t* b, size_t nb, uint64_t* out) {
+    std::fill(out, out + na + nb, 0);
+    for (size_t i = 0; i < na; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++) {
+            const u128 product = static_cast<u128>(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        out[i + nb] = carry;
+    }
+}
+
+// x[offset, ...) += y; x must be long enough to absorb the carry
+void addAt(Limbs& x, size_t offset, const Limbs& y) {
+    uint64_t carry = 0;
+    size_t i = 0;
+    for (; i < y.size(); i++) {
+        const u128 sum = static_cast<u128>(x[offset + i]) + y[i] + carry;
+        x[offset + i] = static_cast<uint64_t>(sum);
+        carry = static_cast<uint64_t>(sum >> 64);
+    }
+    for (; carry != 0; i++) {
+        carry = ++x[offset + i] == 0 ? 1 : 0;
+    }
+}
+
+// x -= y, with x >= y
+void subtractInPlace(Limbs& x, const Limbs& y) {
+    uint64_t borrow = 0;
+    size_t i = 0;
+    for (; i < y.size(); i++) {
+        const uint64_t yi = y[i];
+        const uint64_t difference = x[i] - yi - borrow;
+        borrow = (x[i] < yi || (x[i] == yi && borrow)) ? 1 : 0;
+        x[i] = difference;
+    }
+    for (; borrow != 0; i++) {
+        borrow = x[i] == 0 ? 1 : 0;
+        x[i]--;
+    }
+}
+
+Limbs addLimbs(const uint64_t* a, size_t na, const uint64_t* b, size_t nb) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    Limbs sum(na + 1);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < na; i++) {
+        const u128 s = static_cast<u128>(a[i]) + (i < nb ? b[i] : 0) + carry;
+        sum[i] = static_cast<uint64_t>(s);
+        carry = static_cast<uint64_t>(s >> 64);
+    }
+    sum[na] = carry;
+    return sum;
+}
+
+Limbs multiplyLimbs(const uint64_t* a, size_t na, const uint64_t* b, size_t nb);
+
+// a = a1 * B^m + a0, b = b1 * B^m + b0:
+// a * b = z2 * B^2m + (z1 - z2 - z0) * B^m + z0, with z1 = (a0 + a1)(b0 + b1)
+Limbs karatsuba(const uint64_t* a, size_t na, const uint64_t* b, size_t nb) {
+    const size_t m = std::max(na, nb) / 2;
+    const size_t na0 = std::min(na, m);
+    const size_t nb0 = std::min(nb, m);
+
+    Limbs z0 = multiplyLimbs(a, na0, b, nb0);
+    Limbs z2 = multiplyLimbs(a + na0, na - na0, b + nb0, nb - nb0);
+    const Limbs aSum = addLimbs(a, na0, a + na0, na - na0);
+    const Limbs bSum = addLimbs(b, nb0, b + nb0, nb - nb0);
+    Limbs z1 = multiplyLimbs(aSum.data(), aSum.size(), bSum.data(), bSum.size());
+    trimLimbs(z0);
+    trimLimbs(z2);
+    subtractInPlace(z1, z0);
+    subtractInPlace(z1, z2);
+    trimLimbs(z1);
+
+    Limbs result(na + nb + 1);
+    addAt(result, 0, z0);
+    addAt(result, m, z1);
+    addAt(result, 2 * m, z2);
+    result.resize(na + nb);
+    return result;
+}
+
+Limbs multiplyLimbs(const uint64_t* a, size_t na, const uint64_t* b, size_t nb) {
+    if (na == 0 || nb == 0) {
+        return Limbs(na + nb);
+    }
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < BigUnsigned::karatsubaThreshold) {
+        Limbs result(na + nb);
+        multiplySchoolbookInto(a, na, b, nb, result.data());
+        return result;
+    }
+    if (nb * 2 <= na) {
+        // Unbalanced: multiply b with nb-limb slices of a
+        Limbs result(na + nb + 1);
+        for (size_t offset = 0; offset < na; offset += nb) {
+            const size_t slice = std::min(nb, na - offset);
+            Limbs partial = multiplyLimbs(a + offset, slice, b, nb);
+            trimLimbs(partial);
+            addAt(result, offset, partial);
+        }
+        result.resize(na + nb);
+        return result;
+    }
+    return karatsuba(a, na, b, nb);
+}
+
+}
+
+// ============================================================================
+// BigUnsigned
+// ============================================================================
+
+BigUnsigned::BigUnsigned(uint64_t value) {
+    if (value != 0) {
+        limbs.push_back(value);
+    }
+}
+
+void BigUnsigned::trim() {
+    trimLimbs(limbs);
+}
+
+int BigUnsigned::compare(const BigUnsigned& other) const {
+    if (limbs.size() != other.limbs.size()) {
+        return limbs.size() < other.limbs.size() ? -1 : 1;
+    }
+    for (size_t i = limbs.size(); i-- > 0;) {
+        if (limbs[i] != other.limbs[i]) {
+            return limbs[i] < other.limbs[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+size_t BigUnsigned::bitLength() const {
+    if (limbs.empty()) {
+        return 0;
+    }
+    return limbs.size() * 64 - static_cast<size_t>(__builtin_clzll(limbs.back()));
+}
+
+BigUnsigned BigUnsigned::operator+(const BigUnsigned& other) const {
+    BigUnsigned sum;
+    sum.limbs = addLimbs(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+    sum.trim();
+    return sum;
+}
+
+BigUnsigned BigUnsigned::operator-(const BigUnsigned& other) const {
+    if (*this < other) {
+        throw std::underflow_error("BigUnsigned subtraction would be negative");
+    }
+    BigUnsigned difference = *this;
+    subtractInPlace(difference.limbs, other.limbs);
+    difference.trim();
+    return difference;
+}
+
+BigUnsigned BigUnsigned::operator*(const BigUnsigned& other) const {
+    BigUnsigned product;
+    product.limbs = multiplyLimbs(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+    product.trim();
+    return product;
+}
+
+BigUnsigned BigUnsigned::multiplySchoolbook(const BigUnsigned& a, const BigUnsigned& b) {
+    BigUnsigned product;
+    product.limbs.resize(a.limbs.size() + b.limbs.size());
+    multiplySchoolbookInto(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size(), product.limbs.data());
+    product.trim();
+    return product;
+}
+
+BigUnsigned BigUnsigned::operator<<(size_t bits) const {
+    if (limbs.empty()) {
+        return *this;
+    }
+    const size_t limbShift = bits / 64;
+    const unsigned bitShift = static_cast<unsigned>(bits % 64);
+    BigUnsigned shifted;
+    shifted.limbs.assign(limbs.size() + limbShift + 1, 0);
+    for (size_t i = 0; i < limbs.size(); i++) {
+        shifted.limbs[i + limbShift] |= limbs[i] << bitShift;
+        if (bitShift != 0) {
+            shifted.limbs[i + limbShift + 1] = limbs[i] >> (64 - bitShift);
+        }
+    }
+    shifted.trim();
+    return shifted;
+}
+
+BigUnsigned BigUnsigned::operator>>(size_t bits) const {
+    const size_t limbShift = bits / 64;
+    if (limbShift >= limbs.size()) {
+        return {};
+    }
+    const unsigned bitShift = static_cast<unsigned>(bits % 64);
+    BigUnsigned shifted;
+    shifted.limbs.resize(limbs.size() - limbShift);
+    for (size_t i = 0; i < shifted.limbs.size(); i++) {
+        uint64_t value = limbs[i + limbShift] >> bitShift;
+        if (bitShift != 0 && i + limbShift + 1 < limbs.size()) {
+            value |= limbs[i + limbShift + 1] << (64 - bitShift);
+        }
+        shifted.limbs[i] = value;
+    }
+    shifted.trim();
+    return shifted;
+}
+
+uint64_t BigUnsigned::mod(uint64_t divisor) const {
+    if (divisor == 0) {
+        throw std::invalid_argument("Divisor must not be zero");
+    }
+    u128 remainder = 0;
+    for (size_t i = limbs.size(); i-- > 0;) {
+        remainder = ((remainder << 64) | limbs[i]) % divisor;
+    }
+    return static_cast<uint64_t>(remainder);
+}
+
+BigUnsigned BigUnsigned::fromString(std::string_view text) {
+    if (text.empty()) {
+        throw std::invalid_argument("Number must have at least one digit");
+    }
+    BigUnsigned value;
+    // 19 digits at a time: value = value * 10^chunkDigits + chunk
+    size_t position = 0;
+    while (position < text.size()) {
+        const size_t chunkDigits = std::min<size_t>(digitsPerLimb, text.size() - position);
+        uint64_t chunk = 0;
+        uint64_t scale = 1;
+        for (size_t i = 0; i < chunkDigits; i++) {
+            const char c = text[position + i];
+            if (c < '0' || c > '9') {
+                throw std::invalid_argument("Number must only contain digits");
+            }
+            chunk = chunk * 10 + static_cast<uint64_t>(c - '0');
+            scale *= 10;
+        }
+        uint64_t carry = chunk;
+        for (auto& limb : value.limbs) {
+            const u128 product = static_cast<u128>(limb) * scale + carry;
+            limb = static_cast<uint64_t>(product);
+            carry = static_cast<uint64_t>(product >> 64);
+        }
+        if (carry != 0) {
+            value.limbs.push_back(carry);
+        }
+        position += chunkDigits;
+    }
+    value.trim();
+    return value;
+}
+
+// ============================================================================
+// Decimal conversion - divide and conquer with Barrett division
+// ============================================================================
+
+// Level k splits by P_k = 10^(19 * 2^k). Its Barrett reciprocal
+// R_k = floor(2^(2 b_k) / P_k), b_k = bitLength(P_k), turns x / P_k for
+// x < P_k^2 into a multiplication, a shift and at most a few corrections.
+class DecimalConverter {
+private:
+    std::vector<BigUnsigned> powers;
+    std::vector<BigUnsigned> reciprocals;
+    std::vector<size_t> shifts;
+
+    // Improves an underestimate of floor(2^shift / p) until it is exact.
+    // y' = y + y (2^shift - p y) / 2^shift stays below the true value and
+    // squares the relative error, so a close seed needs one or two steps.
+    static BigUnsigned refineReciprocal(BigUnsigned y, const BigUnsigned& p, size_t shift) {
+        const BigUnsigned one = BigUnsigned(1) << shift;
+        for (;;) {
+            const BigUnsigned error = one - p * y;
+            const BigUnsigned step = (y * error) >> shift;
+            if (step.isZero()) {
+                break;
+            }
+            y = y + step;
+        }
+        while (p * (y + BigUnsigned(1)) <= one) {
+            y = y + BigUnsigned(1);
+        }
+        return y;
+    }
+
+    void addLevel() {
+        const size_t k = powers.size();
+        BigUnsigned power = k == 0 ? BigUnsigned(tenPow19) : powers[k - 1] * powers[k - 1];
+        const size_t shift = 2 * power.bitLength();
+        BigUnsigned seed;
+        if (k == 0) {
+            // floor((2^128 - 1) / 10^19) == floor(2^128 / 10^19)
+            const u128 r = ~u128{0} / tenPow19;
+            seed.limbs = {static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64)};
+            seed.trim();
+        } else {
+            // R_(k-1)^2 scaled from 2 * shifts[k-1] to shift bits
+            const BigUnsigned square = reciprocals[k - 1] * reciprocals[k - 1];
+            const size_t squareShift = 2 * shifts[k - 1];
+            seed = shift >= squareShift ? square << (shift - squareShift) : square >> (squareShift - shift);
+        }
+        reciprocals.push_back(refineReciprocal(seed, power, shift));
+        powers.push_back(std::move(power));
+        shifts.push_back(shift);
+    }
+
+    // Returns {x / P_k, x % P_k} for x < P_k^2
+    std::pair<BigUnsigned, BigUnsigned> divide(const BigUnsigned& x, size_t k) const {
+        BigUnsigned quotient = (x * reciprocals[k]) >> shifts[k];
+        BigUnsigned remainder = x - quotient * powers[k];
+        while (remainder >= powers[k]) {
+            remainder = remainder - powers[k];
+            quotient = quotient + BigUnsigned(1);
+        }
+        return {std::move(quotient), std::move(remainder)};
+    }
+
+    // Writes x < P_(k+1) as exactly 19 * 2^(k+1) digits, zero padded, ending at end.
+    // k == -1 means x < 10^19.
+    void write(const BigUnsigned& x, int k, char* end) const {
+        if (k < 1) {
+            // At most two limbs: peel off 19 digits at a time
+            BigUnsigned rest = x;
+            const int chunks = k < 0 ? 1 : 2;
+            for (int chunk = 0; chunk < chunks; chunk++) {
+                uint64_t digits = rest.mod(tenPow19);
+                for (int i = 0; i < digitsPerLimb; i++) {
+                    *--end = static_cast<char>('0' + digits % 10);
+                    digits /= 10;
+                }
+                if (chunk + 1 < chunks) {
+                    rest = divide(rest, 0).first;
+                }
+            }
+            return;
+        }
+        auto parts = divide(x, static_cast<size_t>(k));
+        const size_t lowDigits = static_cast<size_t>(digitsPerLimb) << k;
+        write(parts.second, k - 1, end);
+        write(parts.first, k - 1, end - lowDigits);
+    }
+
+public:
+    std::string convert(const BigUnsigned& x) {
+        if (x.isZero()) {
+            return "0";
+        }
+        if (powers.empty()) {
+            addLevel();
+        }
+        // Smallest level k with x < P_k^2 = P_(k+1)
+        size_t k = 0;
+        for (;;) {
+            if (powers.size() <= k + 1) {
+                addLevel();
+            }
+            if (x < powers[k + 1]) {
+                break;
+            }
+            k++;
+        }
+        std::string digits(static_cast<size_t>(digitsPerLimb) << (k + 1), '0');
+        write(x, static_cast<int>(k), digits.data() + digits.size());
+        const size_t first = digits.find_first_not_of('0');
+        return digits.substr(first);
+    }
+};
+
+std::string BigUnsigned::toString() const {
+    DecimalConverter converter;
+    return converter.convert(*this);
+}
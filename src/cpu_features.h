@@ -0,0 +1,25 @@
+#pragma once
+
+// ============================================================================
+// CPU feature detection for the SIMD code paths (internal to src/)
+// ============================================================================
+
+// CPU_HAVE_X86_INTRINSICS is defined where <immintrin.h> and the target
+// attribute are available, so AVX2 code can be compiled and picked at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPU_HAVE_X86_INTRINSICS 1
+#endif
+
+#ifdef CPU_HAVE_X86_INTRINSICS
+
+// Whether the running CPU supports AVX2, checked once
+inline bool hasAvx2() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include "credentials_batch.h"
+#include <algorithm>
+#include <future>
+
+// ============================================================================
+// CredentialsBatchResult
+// ============================================================================
+
+void CredentialsBatchResult::reserve(size_t capacity) {
+    if (sanitized.size() < capacity) {
+        sanitized.resize(capacity);
+        emailErrors.resize(capacity);
+        passwordErrors.resize(capacity);
+    }
+}
+
+void CredentialsBatchResult::prepare(size_t items) {
+    reserve(items);
+    count = items;
+}
+
+void CredentialsBatchResult::validateRange(const Credentials* inputs, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        emailErrors[i] = trySanitizeAndValidateEmail(inputs[i].email, sanitized[i].email);
+        passwordErrors[i] = trySanitizeAndValidatePassword(inputs[i].plainPassword, sanitized[i].plainPassword);
+    }
+}
+
+std::pmr::vector<ValidationError> CredentialsBatchResult::errors(size_t i, const RequestAllocator& alloc) const {
+    std::pmr::vector<ValidationError> result(alloc);
+    if (emailErrors[i] != nullptr) {
+        result.emplace_back("email", emailErrors[i]);
+    }
+    if (passwordErrors[i] != nullptr) {
+        result.emplace_back("plainPassword", passwordErrors[i]);
+    }
+    return result;
+}
+
+size_t CredentialsBatchResult::validCount() const {
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) {
+        valid += ok(i) ? 1 : 0;
+    }
+    return valid;
+}
+
+// ============================================================================
+// validateBatch
+// ============================================================================
+
+void validateBatch(const Credentials* inputs, size_t count, CredentialsBatchResult& result,
+                   ThreadPool* pool, size_t minItemsPerTask) {
+    result.prepare(count);
+
+    const size_t tasks = pool == nullptr ? 1
+        : std::min(pool->threadCount(), count / std::max<size_t>(minItemsPerTask, 1));
+    if (tasks <= 1) {
+        result.validateRange(inputs, 0, count);
+        return;
+    }
+
+    // Chunks write disjoint slots, so they need no synchronization
+    const size_t chunk = (count + tasks - 1) / tasks;
+    std::vector<std::future<void>> pending;
+    pending.reserve(tasks - 1);
+    size_t begin = 0;
+    try {
+        for (; begin + chunk < count; begin += chunk) {
+            const size_t end = begin + chunk;
+            pending.push_back(pool->submit([&result, inputs, begin, end] {
+                result.validateRange(inputs, begin, end);
+            }));
+        }
+        result.validateRange(inputs, begin, count);
+    } catch (...) {
+        // The submitted chunks still write to result and read inputs
+        for (auto& task : pending) {
+            task.wait();
+        }
+        throw;
+    }
+
+    // Every chunk has to finish before an exception leaves with result
+    for (auto& task : pending) {
+        task.wait();
+    }
+    for (auto& task : pending) {
+        task.get();
+    }
+}
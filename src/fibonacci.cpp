@@ -1,6 +1,325 @@
 #include "fibonacci.h"
+#include "cpu_features.h"
 #include <stdexcept>
 
-int64_t Fibonacci::calc(int index) const {
-    throw std::runtime_error("Not implemented yet");
+namespace {
+
+uint64_t mulMod(uint64_t a, uint64_t b, uint64_t m) {
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+}
+
+uint64_t addMod(uint64_t a, uint64_t b, uint64_t m) {
+    return a >= m - b ? a - (m - b) : a + b;
+}
+
+uint64_t subMod(uint64_t a, uint64_t b, uint64_t m) {
+    return a >= b ? a - b : a + (m - b);
+}
+
+int topBitOf(uint64_t value) {
+    return value == 0 ? -1 : 63 - __builtin_clzll(value);
+}
+
+// Montgomery arithmetic modulo an odd m < 2^32 with R = 2^32. Values stay in
+// [0, m), so products fit in 64 bits and there is no division per step.
+struct Montgomery32 {
+    uint32_t m;
+    uint32_t inverse;   // m^-1 mod 2^32
+    uint32_t one;       // R mod m, 1 in Montgomery form
+
+    explicit Montgomery32(uint32_t modulus)
+        : m(modulus), inverse(modulus), one(static_cast<uint32_t>((uint64_t{1} << 32) % modulus)) {
+        // m is its own inverse to 3 bits; each Newton step doubles that
+        for (int i = 0; i < 4; i++) {
+            inverse *= 2 - modulus * inverse;
+        }
+    }
+
+    // t / R mod m for t < m * R
+    uint32_t reduce(uint64_t t) const {
+        const uint32_t u = static_cast<uint32_t>(t) * inverse;
+        const uint64_t um = static_cast<uint64_t>(u) * m;
+        // t and um agree in the low 32 bits, so this is (t - um) / R exactly
+        const int64_t r = static_cast<int64_t>(t >> 32) - static_cast<int64_t>(um >> 32);
+        return static_cast<uint32_t>(r < 0 ? r + m : r);
+    }
+
+    uint32_t mul(uint32_t a, uint32_t b) const {
+        return reduce(static_cast<uint64_t>(a) * b);
+    }
+};
+
+// Barrett arithmetic modulo any m < 2^32, for the even moduli Montgomery
+// can't take
+struct Barrett32 {
+    uint64_t m;
+    uint64_t factor;    // floor((2^64 - 1) / m)
+    uint32_t one;
+
+    explicit Barrett32(uint32_t modulus)
+        : m(modulus), factor(UINT64_MAX / modulus), one(static_cast<uint32_t>(1 % modulus)) {}
+
+    uint32_t mul(uint32_t a, uint32_t b) const {
+        const uint64_t t = static_cast<uint64_t>(a) * b;
+        // The estimated quotient is at most one too small
+        const uint64_t q = static_cast<uint64_t>((static_cast<unsigned __int128>(t) * factor) >> 64);
+        const uint64_t r = t - q * m;
+        return static_cast<uint32_t>(r >= m ? r - m : r);
+    }
+
+    uint32_t reduce(uint64_t t) const {
+        return static_cast<uint32_t>(t);
+    }
+};
+
+// Fast doubling as in calcMod, with products reduced by Arithmetic; reduce()
+// takes the result out of the arithmetic's representation
+template <typename Arithmetic>
+uint64_t calcModWith(uint64_t index, const Arithmetic& arithmetic) {
+    const uint64_t m = arithmetic.m;
+    uint32_t a = 0;
+    uint32_t b = arithmetic.one;
+    for (int bit = topBitOf(index); bit >= 0; bit--) {
+        const uint32_t c = arithmetic.mul(a, static_cast<uint32_t>(subMod(addMod(b, b, m), a, m)));
+        const uint32_t d = static_cast<uint32_t>(addMod(arithmetic.mul(a, a), arithmetic.mul(b, b), m));
+        if ((index >> bit) & 1) {
+            a = d;
+            b = static_cast<uint32_t>(addMod(c, d, m));
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+    return arithmetic.reduce(a);
+}
+
+template <typename Arithmetic>
+void calcModBatchScalar(const uint64_t* indices, size_t count, const Arithmetic& arithmetic, uint64_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = calcModWith(indices[i], arithmetic);
+    }
+}
+
+#ifdef CPU_HAVE_X86_INTRINSICS
+
+// Lane-wise versions of the Montgomery32 operations on four 64-bit lanes that
+// hold values below m < 2^32
+
+__attribute__((target("avx2")))
+inline __m256i mulLanes(__m256i a, __m256i b, __m256i m, __m256i inverse) {
+    // mul_epu32 reads the low 32 bits of each lane, which truncates t and u
+    const __m256i t = _mm256_mul_epu32(a, b);
+    const __m256i u = _mm256_mul_epu32(t, inverse);
+    const __m256i um = _mm256_mul_epu32(u, m);
+    const __m256i r = _mm256_sub_epi64(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(um, 32));
+    return _mm256_add_epi64(r, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), r), m));
+}
+
+__attribute__((target("avx2")))
+inline __m256i addLanes(__m256i a, __m256i b, __m256i m) {
+    const __m256i s = _mm256_add_epi64(a, b);
+    return _mm256_sub_epi64(s, _mm256_andnot_si256(_mm256_cmpgt_epi64(m, s), m));
+}
+
+__attribute__((target("avx2")))
+inline __m256i subLanes(__m256i a, __m256i b, __m256i m) {
+    const __m256i r = _mm256_sub_epi64(a, b);
+    return _mm256_add_epi64(r, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), r), m));
+}
+
+// Runs four indices per vector; the lanes share the loop over bits, which
+// starts at the highest bit set in any of them, since leading zero bits keep
+// a lane at (F(0), F(1)). The tail is finished by the scalar loop.
+__attribute__((target("avx2")))
+void calcModBatchAvx2(const uint64_t* indices, size_t count, const Montgomery32& mont, uint64_t* out) {
+    const __m256i m = _mm256_set1_epi64x(mont.m);
+    const __m256i inverse = _mm256_set1_epi64x(mont.inverse);
+    const __m256i one = _mm256_set1_epi64x(mont.one);
+    const __m256i plainOne = _mm256_set1_epi64x(1);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const int topBit = topBitOf(indices[i] | indices[i + 1] | indices[i + 2] | indices[i + 3]);
+        // The bit being processed is moved to the sign bit of each lane
+        __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+        bits = _mm256_sll_epi64(bits, _mm_cvtsi32_si128(topBit < 0 ? 0 : 63 - topBit));
+        __m256i a = zero;
+        __m256i b = one;
+        for (int bit = topBit; bit >= 0; bit--) {
+            const __m256i c = mulLanes(a, subLanes(addLanes(b, b, m), a, m), m, inverse);
+            const __m256i d = addLanes(mulLanes(a, a, m, inverse), mulLanes(b, b, m, inverse), m);
+            const __m256i set = _mm256_cmpgt_epi64(zero, bits);
+            a = _mm256_blendv_epi8(c, d, set);
+            b = _mm256_blendv_epi8(d, addLanes(c, d, m), set);
+            bits = _mm256_slli_epi64(bits, 1);
+        }
+        // Multiplying by plain 1 takes a out of Montgomery form
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), mulLanes(a, plainOne, m, inverse));
+    }
+    calcModBatchScalar(indices + i, count - i, mont, out + i);
+}
+
+using CalcModBatchFn = void (*)(const uint64_t*, size_t, const Montgomery32&, uint64_t*);
+
+CalcModBatchFn selectCalcModBatch() {
+    return hasAvx2() ? calcModBatchAvx2 : calcModBatchScalar<Montgomery32>;
+}
+
+#endif
+
+void calcModBatchMontgomery(const uint64_t* indices, size_t count, const Montgomery32& mont, uint64_t* out) {
+#ifdef CPU_HAVE_X86_INTRINSICS
+    static const CalcModBatchFn implementation = selectCalcModBatch();
+    implementation(indices, count, mont, out);
+#else
+    calcModBatchScalar(indices, count, mont, out);
+#endif
+}
+
+}
+
+// ============================================================================
+// PisanoCache
+// ============================================================================
+
+PisanoCache::PisanoCache(uint64_t maxModulus, size_t maxTables) : maxModulus(maxModulus), maxTables(maxTables) {
+    if (maxModulus > modulusLimit) {
+        throw std::invalid_argument("maxModulus must be at most 2^20");
+    }
+    if (maxTables == 0) {
+        throw std::invalid_argument("maxTables must be at least 1");
+    }
+}
+
+uint64_t PisanoCache::period(uint64_t modulus) {
+    if (modulus == 0) {
+        throw std::invalid_argument("Modulus must be at least 1");
+    }
+    // The pair (F(i), F(i+1)) mod m returns to (0, 1) after pi(m) <= 6m steps
+    const uint64_t first = 1 % modulus;
+    uint64_t a = 0;
+    uint64_t b = first;
+    for (uint64_t i = 1;; i++) {
+        const uint64_t next = addMod(a, b, modulus);
+        a = b;
+        b = next;
+        if (a == 0 && b == first) {
+            return i;
+        }
+    }
+}
+
+std::shared_ptr<const std::vector<uint32_t>> PisanoCache::table(uint64_t modulus) {
+    if (modulus == 0 || modulus > maxModulus) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = tables.find(modulus);
+        if (it != tables.end()) {
+            return it->second;
+        }
+    }
+
+    // Built without the lock; if another thread builds the same table
+    // meanwhile, the first one stored wins
+    const uint64_t length = period(modulus);
+    auto values = std::make_shared<std::vector<uint32_t>>(length);
+    uint64_t a = 0;
+    uint64_t b = 1 % modulus;
+    for (uint64_t i = 0; i < length; i++) {
+        (*values)[i] = static_cast<uint32_t>(a);
+        const uint64_t next = addMod(a, b, modulus);
+        a = b;
+        b = next;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto inserted = tables.emplace(modulus, std::move(values));
+    if (inserted.second) {
+        order.push_back(modulus);
+        if (order.size() > maxTables) {
+            tables.erase(order.front());
+            order.pop_front();
+        }
+    }
+    return inserted.first->second;
+}
+
+size_t PisanoCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tables.size();
+}
+
+// ============================================================================
+// Fibonacci
+// ============================================================================
+
+std::pair<uint64_t, uint64_t> Fibonacci::calcModPair(uint64_t index, uint64_t modulus) const {
+    if (modulus == 0) {
+        throw std::invalid_argument("Modulus must be at least 1");
+    }
+    // (a, b) = (F(k), F(k+1)), walking the bits of index from the top
+    uint64_t a = 0;
+    uint64_t b = 1 % modulus;
+    for (int bit = topBitOf(index); bit >= 0; bit--) {
+        const uint64_t c = mulMod(a, subMod(addMod(b, b, modulus), a, modulus), modulus);
+        const uint64_t d = addMod(mulMod(a, a, modulus), mulMod(b, b, modulus), modulus);
+        if ((index >> bit) & 1) {
+            a = d;
+            b = addMod(c, d, modulus);
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+    return {a, b};
+}
+
+uint64_t Fibonacci::calcMod(uint64_t index, uint64_t modulus) const {
+    return calcModPair(index, modulus).first;
+}
+
+void Fibonacci::calcModBatch(const uint64_t* indices, size_t count, uint64_t modulus, uint64_t* out,
+                             PisanoCache* cache) const {
+    if (modulus == 0) {
+        throw std::invalid_argument("Modulus must be at least 1");
+    }
+    if (cache != nullptr) {
+        if (auto table = cache->table(modulus)) {
+            const uint64_t length = table->size();
+            for (size_t i = 0; i < count; i++) {
+                out[i] = (*table)[indices[i] % length];
+            }
+            return;
+        }
+    }
+    if (modulus < (uint64_t{1} << 32)) {
+        if (modulus % 2 == 1) {
+            calcModBatchMontgomery(indices, count, Montgomery32(static_cast<uint32_t>(modulus)), out);
+        } else {
+            calcModBatchScalar(indices, count, Barrett32(static_cast<uint32_t>(modulus)), out);
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = calcMod(indices[i], modulus);
+    }
+}
+
+BigUnsigned Fibonacci::calcBig(uint64_t index) const {
+    BigUnsigned a;
+    BigUnsigned b(1);
+    for (int bit = topBitOf(index); bit >= 0; bit--) {
+        const BigUnsigned c = a * ((b << 1) - a);
+        const BigUnsigned d = a * a + b * b;
+        if ((index >> bit) & 1) {
+            a = d;
+            b = c + d;
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+    return a;
 }
@@ -0,0 +1,76 @@
+#include "fibonacci_range.h"
+#include <atomic>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include "fibonacci.h"
+
+namespace {
+
+// Fills out[0, count) with F(first + i) mod modulus
+void fillChunk(uint64_t first, size_t count, uint64_t modulus, uint64_t* out) {
+    auto [a, b] = Fibonacci().calcModPair(first, modulus);
+    for (size_t i = 0; i < count; i++) {
+        out[i] = a;
+        const uint64_t next = a >= modulus - b ? a - (modulus - b) : a + b;
+        a = b;
+        b = next;
+    }
+}
+
+}
+
+void fibonacci_detail::checkRange(uint64_t first, size_t count, uint64_t modulus) {
+    if (modulus == 0) {
+        throw std::invalid_argument("Modulus must be at least 1");
+    }
+    if (count > 0 && count - 1 > UINT64_MAX - first) {
+        throw std::invalid_argument("Range ends past the largest index");
+    }
+}
+
+uint64_t* fibonacciModRange(uint64_t first, size_t count, uint64_t modulus, uint64_t* out,
+                            ThreadPool* pool, size_t minItemsPerTask) {
+    fibonacci_detail::checkRange(first, count, modulus);
+
+    const size_t chunkSize = std::max<size_t>(minItemsPerTask, 1);
+    const size_t chunks = (count + chunkSize - 1) / chunkSize;
+    if (pool == nullptr || chunks <= 1) {
+        fillChunk(first, count, modulus, out);
+        return out + count;
+    }
+
+    // Chunks write disjoint slots, so only the counter is shared
+    std::atomic<size_t> nextChunk{0};
+    auto work = [&nextChunk, chunks, chunkSize, first, count, modulus, out] {
+        for (size_t chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+            const size_t begin = chunk * chunkSize;
+            fillChunk(first + begin, std::min(chunkSize, count - begin), modulus, out + begin);
+        }
+    };
+
+    const size_t helpers = std::min(pool->threadCount(), chunks - 1);
+    std::vector<std::future<void>> pending;
+    pending.reserve(helpers);
+    for (size_t i = 0; i < helpers; i++) {
+        // A helper that can't be queued only means more chunks for this
+        // thread; that includes a pool shutting down, which must not unwind
+        // past the helpers already queued
+        std::optional<std::future<void>> task;
+        try {
+            task = pool->trySubmit(work);
+        } catch (const std::runtime_error&) {
+        }
+        if (!task) {
+            break;
+        }
+        pending.push_back(std::move(*task));
+    }
+    work();
+
+    // Helpers still reference this frame until they have run
+    for (auto& task : pending) {
+        task.get();
+    }
+    return out + count;
+}
@@ -1,11 +1,39 @@
 #include "login_service.h"
 #include "repository.h"
 #include "uss.h"
-#include <algorithm>
-#include <regex>
-#include <cctype>
+#include <utility>
 
 
+LoginService::LoginService(std::shared_ptr<PersonRepository> repository,
+                           std::shared_ptr<PasswordHasher> passwordHasher,
+                           std::shared_ptr<UuidGenerator> sessionIdGenerator)
+    : personRepo(std::move(repository)), hasher(std::move(passwordHasher)),
+      sessionIds(std::move(sessionIdGenerator)) {}
+
+std::optional<Person> LoginService::getPerson(const std::string& email) {
+    try {
+        return personRepo->get(email);
+    } catch (const RepositoryException& e) {
+        throw ServerException(std::string("Login failed: ") + e.what());
+    }
+}
+
 Session LoginService::login(const Credentials& credentials) {
-    return {"todo"};
+    const Credentials sanitized = sanitizeAndValidateCredentials(credentials);
+
+    const auto person = getPerson(std::string(sanitized.email));
+    if (!person) {
+        std::call_once(dummyHashOnce, [this] { dummyHash = hasher->hash(""); });
+        hasher->verify(sanitized.plainPassword, dummyHash);
+        throw LoginException(invalidCredentialsMessage);
+    }
+    // The status is only revealed to callers who know the password
+    if (!hasher->verify(sanitized.plainPassword, person->passwordHash)) {
+        throw LoginException(invalidCredentialsMessage);
+    }
+    if (person->status != "active") {
+        throw LoginException(inactiveAccountMessage);
+    }
+
+    return {std::string(person->id), sessionIds->create()};
 }
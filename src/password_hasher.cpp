@@ -0,0 +1,388 @@
+#include "password_hasher.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+// ============================================================================
+// SHA-256
+// ============================================================================
+
+namespace {
+
+constexpr uint32_t roundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr uint32_t initialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+uint32_t rotateRight(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+uint32_t loadBigEndian32(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+void storeBigEndian32(uint32_t x, uint8_t* p) {
+    p[0] = uint8_t(x >> 24);
+    p[1] = uint8_t(x >> 16);
+    p[2] = uint8_t(x >> 8);
+    p[3] = uint8_t(x);
+}
+
+// Processes one 64-byte block given as 16 big-endian words
+void compressWords(uint32_t state[8], const uint32_t block[16]) {
+    uint32_t w[64];
+    std::copy(block, block + 16, w);
+    for (int i = 16; i < 64; i++) {
+        const uint32_t s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+        const uint32_t s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+        const uint32_t choice = (e & f) ^ (~e & g);
+        const uint32_t t1 = h + s1 + choice + roundConstants[i] + w[i];
+        const uint32_t s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+        const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t t2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+void compressBytes(uint32_t state[8], const uint8_t* bytes) {
+    uint32_t block[16];
+    for (int i = 0; i < 16; i++) {
+        block[i] = loadBigEndian32(bytes + 4 * i);
+    }
+    compressWords(state, block);
+}
+
+// Streaming SHA-256 for the parts of PBKDF2 whose input has no fixed shape
+class Sha256 {
+private:
+    uint32_t state[8];
+    uint8_t buffer[64];
+    size_t buffered = 0;
+    uint64_t totalLength = 0;
+
+public:
+    Sha256() {
+        std::copy(initialState, initialState + 8, state);
+    }
+
+    // Starts from a state that has already absorbed `absorbed` whole blocks
+    Sha256(const uint32_t from[8], uint64_t absorbed) : totalLength(absorbed) {
+        std::copy(from, from + 8, state);
+    }
+
+    void update(const uint8_t* data, size_t length) {
+        totalLength += length;
+        while (length > 0) {
+            const size_t take = std::min(length, sizeof(buffer) - buffered);
+            std::memcpy(buffer + buffered, data, take);
+            buffered += take;
+            data += take;
+            length -= take;
+            if (buffered == sizeof(buffer)) {
+                compressBytes(state, buffer);
+                buffered = 0;
+            }
+        }
+    }
+
+    void update(std::string_view data) {
+        update(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    }
+
+    void finish(uint8_t out[32]) {
+        const uint64_t bitLength = totalLength * 8;
+        const uint8_t pad = 0x80;
+        update(&pad, 1);
+        const uint8_t zero = 0;
+        while (buffered != 56) {
+            update(&zero, 1);
+        }
+        uint8_t lengthBytes[8];
+        for (int i = 0; i < 8; i++) {
+            lengthBytes[i] = uint8_t(bitLength >> (56 - 8 * i));
+        }
+        update(lengthBytes, 8);
+        for (int i = 0; i < 8; i++) {
+            storeBigEndian32(state[i], out + 4 * i);
+        }
+    }
+};
+
+// HMAC-SHA256 with the key pads absorbed once up front. Each PBKDF2
+// iteration then hashes a fixed 96-byte message (pad block + 32-byte
+// digest), which is one compression per side on a pre-padded block.
+class HmacSha256 {
+private:
+    uint32_t innerState[8];
+    uint32_t outerState[8];
+
+    // One block holding a 32-byte message after a 64-byte pad: 8 digest
+    // words, the 0x80 terminator, zeros and the bit length 96 * 8
+    static void digestBlock(const uint32_t state[8], const uint32_t digest[8], uint32_t out[8]) {
+        uint32_t block[16] = {0};
+        std::copy(digest, digest + 8, block);
+        block[8] = 0x80000000;
+        block[15] = 96 * 8;
+        std::copy(state, state + 8, out);
+        compressWords(out, block);
+    }
+
+public:
+    explicit HmacSha256(std::string_view key) {
+        uint8_t keyBlock[64] = {0};
+        if (key.size() > sizeof(keyBlock)) {
+            Sha256 keyHash;
+            keyHash.update(key);
+            keyHash.finish(keyBlock);
+        } else {
+            std::memcpy(keyBlock, key.data(), key.size());
+        }
+        uint8_t innerPad[64];
+        uint8_t outerPad[64];
+        for (int i = 0; i < 64; i++) {
+            innerPad[i] = keyBlock[i] ^ 0x36;
+            outerPad[i] = keyBlock[i] ^ 0x5c;
+        }
+        std::copy(initialState, initialState + 8, innerState);
+        std::copy(initialState, initialState + 8, outerState);
+        compressBytes(innerState, innerPad);
+        compressBytes(outerState, outerPad);
+    }
+
+    // HMAC of an arbitrary message, as big-endian words
+    void mac(const uint8_t* message, size_t length, uint32_t out[8]) const {
+        Sha256 inner(innerState, 64);
+        inner.update(message, length);
+        uint8_t innerDigest[32];
+        inner.finish(innerDigest);
+        uint32_t innerWords[8];
+        for (int i = 0; i < 8; i++) {
+            innerWords[i] = loadBigEndian32(innerDigest + 4 * i);
+        }
+        digestBlock(outerState, innerWords, out);
+    }
+
+    // HMAC of a previous 32-byte HMAC output
+    void macDigest(const uint32_t digest[8], uint32_t out[8]) const {
+        uint32_t innerWords[8];
+        digestBlock(innerState, digest, innerWords);
+        digestBlock(outerState, innerWords, out);
+    }
+};
+
+const char hexDigits[] = "0123456789abcdef";
+
+std::string toHex(const uint8_t* bytes, size_t length) {
+    std::string hex(length * 2, '\0');
+    for (size_t i = 0; i < length; i++) {
+        hex[2 * i] = hexDigits[bytes[i] >> 4];
+        hex[2 * i + 1] = hexDigits[bytes[i] & 0x0f];
+    }
+    return hex;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool fromHex(std::string_view hex, std::string& out) {
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+    out.resize(hex.size() / 2);
+    for (size_t i = 0; i < out.size(); i++) {
+        const int high = hexValue(hex[2 * i]);
+        const int low = hexValue(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out[i] = static_cast<char>((high << 4) | low);
+    }
+    return true;
+}
+
+const std::string_view pbkdf2Prefix = "pbkdf2-sha256$";
+
+}
+
+std::array<uint8_t, 32> sha256(std::string_view data) {
+    std::array<uint8_t, 32> digest;
+    Sha256 hash;
+    hash.update(data);
+    hash.finish(digest.data());
+    return digest;
+}
+
+std::vector<uint8_t> pbkdf2HmacSha256(std::string_view password, std::string_view salt,
+                                      uint32_t iterations, size_t keyLength) {
+    if (iterations == 0) {
+        throw std::invalid_argument("iterations must be at least 1");
+    }
+    const HmacSha256 hmac(password);
+    std::vector<uint8_t> key(keyLength);
+    std::vector<uint8_t> first(salt.size() + 4);
+    std::memcpy(first.data(), salt.data(), salt.size());
+
+    for (uint32_t blockIndex = 1; (blockIndex - 1) * 32 < keyLength; blockIndex++) {
+        storeBigEndian32(blockIndex, first.data() + salt.size());
+        uint32_t u[8];
+        hmac.mac(first.data(), first.size(), u);
+        uint32_t t[8];
+        std::copy(u, u + 8, t);
+        for (uint32_t i = 1; i < iterations; i++) {
+            hmac.macDigest(u, u);
+            for (int j = 0; j < 8; j++) {
+                t[j] ^= u[j];
+            }
+        }
+
+        uint8_t block[32];
+        for (int j = 0; j < 8; j++) {
+            storeBigEndian32(t[j], block + 4 * j);
+        }
+        const size_t offset = (blockIndex - 1) * 32;
+        std::memcpy(key.data() + offset, block, std::min<size_t>(32, keyLength - offset));
+    }
+    return key;
+}
+
+bool constantTimeEquals(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    // volatile keeps the compiler from turning this into an early-exit loop
+    volatile uint8_t difference = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        difference = difference | static_cast<uint8_t>(a[i] ^ b[i]);
+    }
+    return difference == 0;
+}
+
+// ============================================================================
+// Pbkdf2PasswordHasher
+// ============================================================================
+
+Pbkdf2PasswordHasher::Pbkdf2PasswordHasher(uint32_t iterations, uint32_t maxIterations)
+    : iterationCount(iterations), iterationLimit(maxIterations) {
+    if (iterations == 0 || iterations > maxIterations) {
+        throw std::invalid_argument("iterations must be between 1 and maxIterations");
+    }
+}
+
+std::string Pbkdf2PasswordHasher::hash(std::string_view password) {
+    static thread_local std::random_device rd;
+    uint8_t salt[saltLength];
+    for (size_t i = 0; i < saltLength; i += 4) {
+        storeBigEndian32(rd(), salt + i);
+    }
+    const auto key = pbkdf2HmacSha256(password, std::string_view(reinterpret_cast<const char*>(salt), saltLength),
+                                      iterationCount, keyLength);
+    return std::string(pbkdf2Prefix) + std::to_string(iterationCount) + "$" +
+           toHex(salt, saltLength) + "$" + toHex(key.data(), key.size());
+}
+
+bool Pbkdf2PasswordHasher::verify(std::string_view password, std::string_view encodedHash) {
+    if (encodedHash.substr(0, pbkdf2Prefix.size()) != pbkdf2Prefix) {
+        return false;
+    }
+    std::string_view rest = encodedHash.substr(pbkdf2Prefix.size());
+    const size_t saltStart = rest.find('$');
+    const size_t keyStart = saltStart == std::string_view::npos ? saltStart : rest.find('$', saltStart + 1);
+    if (keyStart == std::string_view::npos) {
+        return false;
+    }
+
+    uint32_t iterations = 0;
+    const auto parsed = std::from_chars(rest.data(), rest.data() + saltStart, iterations);
+    if (parsed.ec != std::errc() || parsed.ptr != rest.data() + saltStart ||
+        iterations == 0 || iterations > iterationLimit) {
+        return false;
+    }
+    // The key length drives the work like the iterations do, so only the
+    // length hash() writes is accepted
+    const std::string_view keyHex = rest.substr(keyStart + 1);
+    if (keyHex.size() != 2 * keyLength) {
+        return false;
+    }
+    std::string salt;
+    std::string expected;
+    if (!fromHex(rest.substr(saltStart + 1, keyStart - saltStart - 1), salt) || !fromHex(keyHex, expected)) {
+        return false;
+    }
+
+    const auto key = pbkdf2HmacSha256(password, salt, iterations, expected.size());
+    return constantTimeEquals(std::string_view(reinterpret_cast<const char*>(key.data()), key.size()), expected);
+}
+
+// ============================================================================
+// PooledPasswordHasher
+// ============================================================================
+
+size_t PooledPasswordHasher::defaultThreadCount() {
+    return std::max<size_t>(1, std::thread::hardware_concurrency() / 2);
+}
+
+PooledPasswordHasher::PooledPasswordHasher(std::shared_ptr<PasswordHasher> hasher, size_t threadCount,
+                                           size_t queueCapacity)
+    : inner(std::move(hasher)), pool(threadCount, queueCapacity) {}
+
+std::string PooledPasswordHasher::hash(std::string_view password) {
+    return hashAsync(password).get();
+}
+
+bool PooledPasswordHasher::verify(std::string_view password, std::string_view encodedHash) {
+    return verifyAsync(password, encodedHash).get();
+}
+
+std::future<std::string> PooledPasswordHasher::hashAsync(std::string_view password) {
+    auto hasher = inner;
+    return pool.submit([hasher, password = std::string(password)] { return hasher->hash(password); });
+}
+
+std::future<bool> PooledPasswordHasher::verifyAsync(std::string_view password, std::string_view encodedHash) {
+    auto hasher = inner;
+    return pool.submit([hasher, password = std::string(password), encodedHash = std::string(encodedHash)] {
+        return hasher->verify(password, encodedHash);
+    });
+}
+
+std::optional<std::future<bool>> PooledPasswordHasher::tryVerifyAsync(std::string_view password,
+                                                                      std::string_view encodedHash) {
+    auto hasher = inner;
+    return pool.trySubmit([hasher, password = std::string(password), encodedHash = std::string(encodedHash)] {
+        return hasher->verify(password, encodedHash);
+    });
+}
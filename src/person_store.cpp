@@ -0,0 +1,203 @@
+#include "person_store.h"
+#include "cpu_features.h"
+#include <limits>
+
+// ============================================================================
+// StringColumn
+// ============================================================================
+
+void StringColumn::append(std::string_view value) {
+    if (!fits(value.size())) {
+        throw RepositoryException("String column is full");
+    }
+    bytes.insert(bytes.end(), value.begin(), value.end());
+    offsets.push_back(static_cast<uint32_t>(bytes.size()));
+}
+
+bool StringColumn::fits(size_t valueBytes) const {
+    return valueBytes <= std::numeric_limits<uint32_t>::max() - bytes.size();
+}
+
+void StringColumn::truncate(size_t count) {
+    bytes.resize(offsets[count]);
+    offsets.resize(count + 1);
+}
+
+void StringColumn::reserve(size_t count, size_t totalBytes) {
+    bytes.reserve(totalBytes);
+    offsets.reserve(count + 1);
+}
+
+// ============================================================================
+// Hash column scans
+// ============================================================================
+
+size_t findMatchingHashScalar(const uint64_t* hashes, size_t count, uint64_t hash, size_t from) {
+    for (size_t i = from; i < count; i++) {
+        if (hashes[i] == hash) {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef CPU_HAVE_X86_INTRINSICS
+
+namespace {
+
+// Compares 16 hashes per iteration; the tail is finished by the scalar loop
+__attribute__((target("avx2")))
+size_t findMatchingHashAvx2(const uint64_t* hashes, size_t count, uint64_t hash, size_t from) {
+    const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(hash));
+    size_t i = from;
+    for (; i + 16 <= count; i += 16) {
+        const auto* block = reinterpret_cast<const __m256i*>(hashes + i);
+        const __m256i eq0 = _mm256_cmpeq_epi64(_mm256_loadu_si256(block), needle);
+        const __m256i eq1 = _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 1), needle);
+        const __m256i eq2 = _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 2), needle);
+        const __m256i eq3 = _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 3), needle);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+        if (!_mm256_testz_si256(any, any)) {
+            return findMatchingHashScalar(hashes, i + 16, hash, i);
+        }
+    }
+    return findMatchingHashScalar(hashes, count, hash, i);
+}
+
+using FindMatchingHashFn = size_t (*)(const uint64_t*, size_t, uint64_t, size_t);
+
+FindMatchingHashFn selectFindMatchingHash() {
+    return hasAvx2() ? findMatchingHashAvx2 : findMatchingHashScalar;
+}
+
+}
+
+size_t findMatchingHash(const uint64_t* hashes, size_t count, uint64_t hash, size_t from) {
+    static const FindMatchingHashFn implementation = selectFindMatchingHash();
+    return implementation(hashes, count, hash, from);
+}
+
+#else
+
+size_t findMatchingHash(const uint64_t* hashes, size_t count, uint64_t hash, size_t from) {
+    return findMatchingHashScalar(hashes, count, hash, from);
+}
+
+#endif
+
+// ============================================================================
+// PersonStore
+// ============================================================================
+
+PersonStore::PersonStore(PersonKey keyColumn, const std::vector<Person>& initialData) : key(keyColumn) {
+    size_t idBytes = 0, emailBytes = 0, passwordHashBytes = 0;
+    for (const auto& person : initialData) {
+        idBytes += person.id.size();
+        emailBytes += person.email.size();
+        passwordHashBytes += person.passwordHash.size();
+    }
+    reserve(initialData.size());
+    ids.reserve(initialData.size(), idBytes);
+    emails.reserve(initialData.size(), emailBytes);
+    passwordHashes.reserve(initialData.size(), passwordHashBytes);
+    for (const auto& person : initialData) {
+        add(person);
+    }
+}
+
+std::optional<Person> PersonStore::get(const std::string& id) {
+    return key == PersonKey::Id ? findById(id) : findByEmail(id);
+}
+
+void PersonStore::add(const Person& person) {
+    if (size() >= std::numeric_limits<uint32_t>::max()) {
+        throw RepositoryException("Repository is full");
+    }
+    if (!ids.fits(person.id.size()) || !emails.fits(person.email.size())
+        || !passwordHashes.fits(person.passwordHash.size())) {
+        throw RepositoryException("String column is full");
+    }
+    const uint8_t status = internStatus(person.status);
+
+    // An allocation can still fail halfway; cut every column back so they
+    // stay the same length
+    const size_t count = size();
+    try {
+        ids.append(person.id);
+        emails.append(person.email);
+        passwordHashes.append(person.passwordHash);
+        statusCodes.push_back(status);
+        idHashes.push_back(hashValue(person.id));
+        emailHashes.push_back(hashValue(person.email));
+    } catch (...) {
+        ids.truncate(count);
+        emails.truncate(count);
+        passwordHashes.truncate(count);
+        statusCodes.resize(count);
+        idHashes.resize(count);
+        emailHashes.resize(count);
+        throw;
+    }
+}
+
+void PersonStore::reserve(size_t count) {
+    ids.reserve(count, 0);
+    emails.reserve(count, 0);
+    passwordHashes.reserve(count, 0);
+    statusCodes.reserve(count);
+    idHashes.reserve(count);
+    emailHashes.reserve(count);
+}
+
+std::optional<Person> PersonStore::findById(std::string_view id) const {
+    if (auto i = find(idHashes, ids, id)) {
+        return at(*i);
+    }
+    return std::nullopt;
+}
+
+std::optional<Person> PersonStore::findByEmail(std::string_view email) const {
+    if (auto i = find(emailHashes, emails, email)) {
+        return at(*i);
+    }
+    return std::nullopt;
+}
+
+Person PersonStore::at(size_t i) const {
+    return Person(ids[i], emails[i], passwordHashes[i], statusNames[statusCodes[i]]);
+}
+
+size_t PersonStore::memoryUsage() const {
+    size_t statusBytes = statusNames.capacity() * sizeof(std::string);
+    for (const auto& name : statusNames) {
+        statusBytes += name.capacity();
+    }
+    return ids.memoryUsage() + emails.memoryUsage() + passwordHashes.memoryUsage()
+           + statusCodes.capacity() + statusBytes
+           + (idHashes.capacity() + emailHashes.capacity()) * sizeof(uint64_t);
+}
+
+std::optional<size_t> PersonStore::find(const std::vector<uint64_t>& hashes, const StringColumn& column,
+                                        std::string_view value) const {
+    const uint64_t hash = hashValue(value);
+    for (size_t i = findMatchingHash(hashes.data(), hashes.size(), hash); i < hashes.size();
+         i = findMatchingHash(hashes.data(), hashes.size(), hash, i + 1)) {
+        if (column[i] == value) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+uint8_t PersonStore::internStatus(std::string_view status) {
+    for (size_t i = 0; i < statusNames.size(); i++) {
+        if (statusNames[i] == status) {
+            return static_cast<uint8_t>(i);
+        }
+    }
+    if (statusNames.size() > std::numeric_limits<uint8_t>::max()) {
+        throw RepositoryException("Too many distinct status values");
+    }
+    statusNames.emplace_back(status);
+    return static_cast<uint8_t>(statusNames.size() - 1);
+}
@@ -0,0 +1,213 @@
+#include "pooled_uuid_generator.h"
+#include <algorithm>
+#include <cstring>
+
+// ============================================================================
+// Ring - single producer (refill thread), single consumer (owning thread)
+// ============================================================================
+
+class PooledUuidGenerator::Ring {
+private:
+    std::vector<char> slots;
+    size_t capacity;
+    size_t idLength;
+    std::atomic<size_t> head{0};  // next slot to pop, written by the consumer
+    std::atomic<size_t> tail{0};  // next slot to fill, written by the producer
+
+public:
+    std::atomic<bool> refillRequested{false};
+
+    Ring(size_t capacity, size_t idLength)
+        : slots(capacity * idLength), capacity(capacity), idLength(idLength) {}
+
+    bool lowOnIds(size_t remaining) const {
+        return remaining <= capacity / 2;
+    }
+
+    // Consumer side: returns false when the ring is empty
+    bool tryPop(char* out, size_t& remaining) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+        if (h == t) {
+            remaining = 0;
+            return false;
+        }
+        std::memcpy(out, &slots[(h % capacity) * idLength], idLength);
+        head.store(h + 1, std::memory_order_release);
+        remaining = t - h - 1;
+        return true;
+    }
+
+    // Producer side: fills every free slot with one or two createInto() calls
+    void refill(UuidGenerator& generator) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+        const size_t free = capacity - (t - h);
+        if (free == 0) {
+            return;
+        }
+        const size_t start = t % capacity;
+        const size_t firstRun = std::min(free, capacity - start);
+        generator.createInto(&slots[start * idLength], firstRun);
+        if (free > firstRun) {
+            generator.createInto(&slots[0], free - firstRun);
+        }
+        tail.store(t + free, std::memory_order_release);
+    }
+};
+
+// ============================================================================
+// PooledUuidGenerator
+// ============================================================================
+
+namespace {
+
+std::atomic<uint64_t> nextPoolId{1};
+
+}
+
+struct PooledUuidGenerator::RingRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+};
+
+// One of the calling thread's rings; unregisters it when the thread exits,
+// unless the pool is gone already
+struct PooledUuidGenerator::ThreadRing {
+    std::weak_ptr<RingRegistry> registry;
+    Ring* ring;
+
+    ThreadRing(std::weak_ptr<RingRegistry> owner, Ring* threadRing) : registry(std::move(owner)), ring(threadRing) {}
+    ThreadRing(const ThreadRing&) = delete;
+    ThreadRing& operator=(const ThreadRing&) = delete;
+
+    ~ThreadRing() {
+        if (auto owner = registry.lock()) {
+            std::lock_guard<std::mutex> lock(owner->mutex);
+            auto& rings = owner->rings;
+            rings.erase(std::remove_if(rings.begin(), rings.end(), [this](const std::shared_ptr<Ring>& r) {
+                return r.get() == ring;
+            }), rings.end());
+        }
+    }
+};
+
+// Rings of this thread by pool ID; only the pool with that ID looks its entry up
+std::unordered_map<uint64_t, PooledUuidGenerator::ThreadRing>& PooledUuidGenerator::threadRings() {
+    static thread_local std::unordered_map<uint64_t, ThreadRing> rings;
+    return rings;
+}
+
+PooledUuidGenerator::PooledUuidGenerator(std::shared_ptr<UuidGenerator> generator, size_t ringCapacity)
+    : inner(std::move(generator)),
+      capacity(ringCapacity),
+      idLength(inner->length()),
+      poolId(nextPoolId.fetch_add(1)),
+      registry(std::make_shared<RingRegistry>()),
+      refiller([this] { refillLoop(); }) {}
+
+PooledUuidGenerator::~PooledUuidGenerator() {
+    {
+        std::lock_guard<std::mutex> lock(refillMutex);
+        stopping = true;
+    }
+    refillWanted.notify_one();
+    refiller.join();
+}
+
+std::string PooledUuidGenerator::create() {
+    std::string id(idLength, '\0');
+    popOrGenerate(threadRing(), id.data());
+    return id;
+}
+
+size_t PooledUuidGenerator::length() const {
+    return idLength;
+}
+
+void PooledUuidGenerator::createInto(char* out, size_t n) {
+    Ring& ring = threadRing();
+    for (size_t i = 0; i < n; i++) {
+        popOrGenerate(ring, out + i * idLength);
+    }
+}
+
+PooledUuidGenerator::Stats PooledUuidGenerator::stats() const {
+    size_t ringCount;
+    {
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        ringCount = registry->rings.size();
+    }
+    return {hits.load(std::memory_order_relaxed), misses.load(std::memory_order_relaxed), ringCount};
+}
+
+PooledUuidGenerator::Ring& PooledUuidGenerator::threadRing() {
+    auto& rings = threadRings();
+    auto it = rings.find(poolId);
+    if (it != rings.end()) {
+        return *it->second.ring;
+    }
+
+    // Entries of destroyed pools are dropped before adding one
+    for (auto entry = rings.begin(); entry != rings.end();) {
+        entry = entry->second.registry.expired() ? rings.erase(entry) : std::next(entry);
+    }
+
+    auto ring = std::make_shared<Ring>(capacity, idLength);
+    {
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        registry->rings.push_back(ring);
+    }
+    // The first pop misses and requests the initial fill
+    rings.try_emplace(poolId, registry, ring.get());
+    return *ring;
+}
+
+void PooledUuidGenerator::popOrGenerate(Ring& ring, char* out) {
+    size_t remaining;
+    if (ring.tryPop(out, remaining)) {
+        hits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        inner->createInto(out, 1);
+    }
+    if (ring.lowOnIds(remaining)) {
+        requestRefill(ring);
+    }
+}
+
+void PooledUuidGenerator::requestRefill(Ring& ring) {
+    // Only the first request until the next refill wakes the refill thread
+    if (!ring.refillRequested.exchange(true, std::memory_order_acq_rel)) {
+        // Set under the mutex, so the refill thread can't miss it between
+        // checking the flag and going to sleep
+        std::lock_guard<std::mutex> lock(refillMutex);
+        refillPending = true;
+        refillWanted.notify_one();
+    }
+}
+
+void PooledUuidGenerator::refillLoop() {
+    std::unique_lock<std::mutex> lock(refillMutex);
+    while (!stopping) {
+        refillWanted.wait(lock, [this] { return stopping || refillPending; });
+        if (stopping) {
+            break;
+        }
+        refillPending = false;
+        lock.unlock();
+
+        std::vector<std::shared_ptr<Ring>> snapshot;
+        {
+            std::lock_guard<std::mutex> registryLock(registry->mutex);
+            snapshot = registry->rings;
+        }
+        for (auto& ring : snapshot) {
+            if (ring->refillRequested.exchange(false, std::memory_order_acq_rel)) {
+                ring->refill(*inner);
+            }
+        }
+
+        lock.lock();
+    }
+}
@@ -0,0 +1,255 @@
+#include "session_store.h"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+// ============================================================================
+// TimingWheel
+// ============================================================================
+
+void TimingWheel::schedule(std::string key, uint64_t deadline) {
+    count++;
+    place(Timer{std::move(key), deadline});
+}
+
+void TimingWheel::place(Timer timer) {
+    // Past deadlines go to the slot processed next
+    uint64_t deadline = std::max(timer.deadline, current);
+    const uint64_t delta = deadline - current;
+    int level = 0;
+    while (level < levels - 1 && delta >= (uint64_t{1} << (slotBits * (level + 1)))) {
+        level++;
+    }
+    if (level == levels - 1) {
+        // Clamped to the last level's horizon; the timer is placed again from
+        // its real deadline when this slot cascades
+        deadline = std::min(deadline, current + (uint64_t{1} << (slotBits * levels)) - 1);
+    }
+    const size_t slot = (deadline >> (slotBits * level)) & (slotsPerLevel - 1);
+    wheel[level][slot].push_back(std::move(timer));
+}
+
+void TimingWheel::cascade(int level) {
+    const size_t slot = (current >> (slotBits * level)) & (slotsPerLevel - 1);
+    std::vector<Timer> timers;
+    timers.swap(wheel[level][slot]);
+    for (auto& timer : timers) {
+        place(std::move(timer));
+    }
+}
+
+void TimingWheel::advance(uint64_t now, const std::function<void(const Timer&)>& onExpired) {
+    for (; current <= now; current++) {
+        // Higher levels first, so their timers can fall through to level 0
+        for (int level = levels - 1; level > 0; level--) {
+            if ((current & ((uint64_t{1} << (slotBits * level)) - 1)) == 0) {
+                cascade(level);
+            }
+        }
+        std::vector<Timer> due;
+        due.swap(wheel[0][current & (slotsPerLevel - 1)]);
+        for (auto& timer : due) {
+            if (timer.deadline <= current) {
+                count--;
+                onExpired(timer);
+            } else {
+                // A clamped timer that came down early
+                place(std::move(timer));
+            }
+        }
+    }
+}
+
+std::optional<TimingWheel::Timer> TimingWheel::popFirst(const std::function<bool(const Timer&)>& accept) {
+    // Level 0 starts at the slot processed next; a higher level starts after
+    // the slot of the current block, which holds the timers one lap ahead
+    for (int level = 0; level < levels && count > 0; level++) {
+        const size_t start = ((current >> (slotBits * level)) + (level > 0 ? 1 : 0)) & (slotsPerLevel - 1);
+        for (size_t i = 0; i < slotsPerLevel && count > 0; i++) {
+            auto& slot = wheel[level][(start + i) & (slotsPerLevel - 1)];
+            while (!slot.empty()) {
+                auto first = std::min_element(slot.begin(), slot.end(), [](const Timer& a, const Timer& b) {
+                    return a.deadline < b.deadline;
+                });
+                Timer timer = std::move(*first);
+                *first = std::move(slot.back());
+                slot.pop_back();
+                count--;
+                if (accept(timer)) {
+                    return timer;
+                }
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void TimingWheel::compact(const std::function<bool(const Timer&)>& keep) {
+    for (auto& level : wheel) {
+        for (auto& slot : level) {
+            const size_t before = slot.size();
+            slot.erase(std::remove_if(slot.begin(), slot.end(), [&keep](const Timer& timer) {
+                return !keep(timer);
+            }), slot.end());
+            count -= before - slot.size();
+        }
+    }
+}
+
+// ============================================================================
+// SessionStore
+// ============================================================================
+
+SessionStore::SessionStore(SessionStoreOptions storeOptions, Clock now)
+    : options(storeOptions), clock(std::move(now)), origin(clock()) {
+    if (options.maxSessions == 0 || options.shardCount == 0) {
+        throw std::invalid_argument("maxSessions and shardCount must be at least 1");
+    }
+    if (options.tick.count() <= 0 || options.ttl.count() <= 0) {
+        throw std::invalid_argument("tick and ttl must be positive");
+    }
+    shardCapacity = (options.maxSessions + options.shardCount - 1) / options.shardCount;
+    shards.reserve(options.shardCount);
+    for (size_t i = 0; i < options.shardCount; i++) {
+        shards.push_back(std::make_unique<Shard>(0));
+    }
+}
+
+uint64_t SessionStore::currentTick() const {
+    const auto elapsed = clock() - origin;
+    return elapsed.count() <= 0 ? 0 : static_cast<uint64_t>(elapsed / options.tick);
+}
+
+SessionStore::Shard& SessionStore::shardFor(std::string_view sessionId) const {
+    return *shards[std::hash<std::string_view>{}(sessionId) % shards.size()];
+}
+
+void SessionStore::advance(Shard& shard, uint64_t now) {
+    shard.wheel.advance(now, [&shard](const TimingWheel::Timer& timer) {
+        auto it = shard.sessions.find(timer.key);
+        if (it != shard.sessions.end() && it->second.expiresAt == timer.deadline) {
+            shard.sessions.erase(it);
+        }
+    });
+}
+
+void SessionStore::evictOne(Shard& shard) {
+    // Skips the timers of removed or replaced sessions on the way
+    shard.wheel.popFirst([&shard](const TimingWheel::Timer& timer) {
+        auto it = shard.sessions.find(timer.key);
+        if (it == shard.sessions.end() || it->second.expiresAt != timer.deadline) {
+            return false;
+        }
+        shard.sessions.erase(it);
+        return true;
+    });
+}
+
+void SessionStore::compactIfStale(Shard& shard) {
+    // Compacting leaves one timer per session, so it runs again only after
+    // as many new timers as there are sessions, O(1) amortized per timer
+    if (shard.wheel.scheduled() <= 2 * shard.sessions.size() + compactionSlack) {
+        return;
+    }
+    // A key removed and added again within one tick has two matching timers
+    std::unordered_set<const std::string*> kept;
+    shard.wheel.compact([&shard, &kept](const TimingWheel::Timer& timer) {
+        auto it = shard.sessions.find(timer.key);
+        return it != shard.sessions.end() && it->second.expiresAt == timer.deadline
+            && kept.insert(&it->first).second;
+    });
+}
+
+void SessionStore::put(const Session& session) {
+    const uint64_t now = currentTick();
+    // A session lives at least ttl, rounded up to whole ticks
+    const uint64_t ticks = static_cast<uint64_t>((options.ttl + options.tick - std::chrono::milliseconds(1)) / options.tick);
+    const uint64_t expiresAt = now + ticks;
+
+    Shard& shard = shardFor(session.sessionId);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    advance(shard, now);
+
+    auto it = shard.sessions.find(session.sessionId);
+    if (it != shard.sessions.end()) {
+        const bool sameDeadline = it->second.expiresAt == expiresAt;
+        it->second = Entry{session, expiresAt};
+        if (sameDeadline) {
+            // The timer already in the wheel still fits
+            return;
+        }
+    } else {
+        if (shard.sessions.size() >= shardCapacity) {
+            evictOne(shard);
+        }
+        shard.sessions.emplace(session.sessionId, Entry{session, expiresAt});
+    }
+    shard.wheel.schedule(session.sessionId, expiresAt);
+    compactIfStale(shard);
+}
+
+std::optional<Session> SessionStore::get(std::string_view sessionId) const {
+    // Reused per thread, so a lookup doesn't allocate a key
+    thread_local std::string key;
+    key.assign(sessionId.data(), sessionId.size());
+    const uint64_t now = currentTick();
+
+    const Shard& shard = shardFor(sessionId);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(key);
+    if (it == shard.sessions.end() || it->second.expiresAt <= now) {
+        return std::nullopt;
+    }
+    return it->second.session;
+}
+
+bool SessionStore::contains(std::string_view sessionId) const {
+    thread_local std::string key;
+    key.assign(sessionId.data(), sessionId.size());
+    const uint64_t now = currentTick();
+
+    const Shard& shard = shardFor(sessionId);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.sessions.find(key);
+    return it != shard.sessions.end() && it->second.expiresAt > now;
+}
+
+bool SessionStore::remove(std::string_view sessionId) {
+    const uint64_t now = currentTick();
+    Shard& shard = shardFor(sessionId);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    advance(shard, now);
+    // The wheel's timer stays behind and is skipped when it fires, or
+    // dropped when the wheel is compacted
+    const bool removed = shard.sessions.erase(std::string(sessionId)) > 0;
+    compactIfStale(shard);
+    return removed;
+}
+
+void SessionStore::expire() {
+    const uint64_t now = currentTick();
+    for (auto& shard : shards) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        advance(*shard, now);
+    }
+}
+
+size_t SessionStore::size() const {
+    size_t total = 0;
+    for (const auto& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        total += shard->sessions.size();
+    }
+    return total;
+}
+
+size_t SessionStore::scheduled() const {
+    size_t total = 0;
+    for (const auto& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        total += shard->wheel.scheduled();
+    }
+    return total;
+}
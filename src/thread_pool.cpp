@@ -0,0 +1,76 @@
+#include "thread_pool.h"
+#include <stdexcept>
+
+// ============================================================================
+// ThreadPool
+// ============================================================================
+
+ThreadPool::ThreadPool(size_t threadCount, size_t queueCapacity) : capacity(queueCapacity) {
+    if (threadCount == 0 || queueCapacity == 0) {
+        throw std::invalid_argument("threadCount and queueCapacity must be at least 1");
+    }
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    spaceAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::threadCount() const {
+    return workers.size();
+}
+
+size_t ThreadPool::queueCapacity() const {
+    return capacity;
+}
+
+size_t ThreadPool::queued() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tasks.size();
+}
+
+bool ThreadPool::enqueue(std::function<void()> task, bool wait) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (wait) {
+            spaceAvailable.wait(lock, [this] { return stopping || tasks.size() < capacity; });
+        }
+        if (stopping) {
+            throw std::runtime_error("ThreadPool is shutting down");
+        }
+        if (tasks.size() >= capacity) {
+            return false;
+        }
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+    return true;
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        spaceAvailable.notify_one();
+        task();
+    }
+}
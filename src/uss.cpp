@@ -1,55 +1,306 @@
 #include "uss.h"
-#include <algorithm>
-#include <regex>
-#include <cctype>
+#include "cpu_features.h"
+#include <cstdint>
+
+ValidationResult<Credentials> validateCredentials(const Credentials& credentials) {
+    ValidationResult<Credentials> result(credentials.get_allocator());
+    auto& sanitized = result.value();
+
+    if (const char* error = trySanitizeAndValidateEmail(credentials.email, sanitized.email)) {
+        result.errors().emplace_back("email", error);
+    }
+    if (const char* error = trySanitizeAndValidatePassword(credentials.plainPassword, sanitized.plainPassword)) {
+        result.errors().emplace_back("plainPassword", error);
+    }
+
+    return result;
+}
 
 Credentials sanitizeAndValidateCredentials(const Credentials& credentials) {
-    std::vector<ValidationError> errors;
-    std::string sanitizedEmail;
-    std::string sanitizedPassword;
+    auto result = validateCredentials(credentials);
+    if (!result) {
+        throw ValidationException(result.errors());
+    }
+    return std::move(result.value());
+}
+
+// ============================================================================
+// Email validation - single-pass state machine
+// ============================================================================
+
+namespace {
+
+enum class EmailError {
+    None,
+    TooShort,
+    TooLong,
+    MissingAt,
+    MultipleAt,
+    EmptyLocalPart,
+    MissingDomainDot,
+    EmptyDomainLabel,
+    InvalidCharacter
+};
+
+const char* emailErrorMessage(EmailError error) {
+    switch (error) {
+        case EmailError::TooShort: return "Email must be at least 6 characters";
+        case EmailError::TooLong: return "Email must be at most 254 characters";
+        case EmailError::MissingAt: return "Email must contain @";
+        case EmailError::MultipleAt: return "Email must contain only one @";
+        case EmailError::EmptyLocalPart: return "Email must have characters before @";
+        case EmailError::MissingDomainDot: return "Email domain must contain .";
+        case EmailError::EmptyDomainLabel: return "Email domain must not have empty labels";
+        case EmailError::InvalidCharacter: return "Email contains invalid characters";
+        case EmailError::None: break;
+    }
+    return "";
+}
 
-    // Try to validate email
-    try {
-        sanitizedEmail = sanitizeAndValidateEmail(credentials.email);
-    } catch (const std::invalid_argument& e) {
-        errors.push_back({"email", e.what()});
+constexpr size_t minEmailLength = 6;
+constexpr size_t maxEmailLength = 254;
+
+bool isEmailSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// Lowercased email is read one character at a time:
+//   Local       - before @, accepts a-z 0-9 . _ % + -
+//   LabelStart  - right after @ or a domain dot, needs a label character
+//   Label       - inside a domain label, accepts a-z 0-9 -
+// Letters and digits never cause an error and move every state except Local
+// to Label, which lets the SIMD path skip whole blocks of them at once.
+class EmailStateMachine {
+public:
+    enum State { Local, LabelStart, Label };
+
+    State state = Local;
+    size_t localLength = 0;
+    bool domainHasDot = false;
+    EmailError error = EmailError::None;
+
+    static bool isAlnum(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+    }
+
+    // Bulk transition for n characters that are all letters or digits
+    void alnumRun(size_t n) {
+        if (state == Local) {
+            localLength += n;
+        } else if (n > 0) {
+            state = Label;
+        }
     }
 
-    // Try to validate password
-    try {
-        sanitizedPassword = sanitizeAndValidatePassword(credentials.plainPassword);
-    } catch (const std::invalid_argument& e) {
-        errors.push_back({"plainPassword", e.what()});
+    // Returns false once an error is found
+    bool step(char c) {
+        if (isAlnum(c)) {
+            alnumRun(1);
+            return true;
+        }
+        switch (state) {
+            case Local:
+                if (c == '@') {
+                    if (localLength == 0) {
+                        return fail(EmailError::EmptyLocalPart);
+                    }
+                    state = LabelStart;
+                } else if (c == '.' || c == '_' || c == '%' || c == '+' || c == '-') {
+                    localLength++;
+                } else {
+                    return fail(EmailError::InvalidCharacter);
+                }
+                return true;
+            case LabelStart:
+            case Label:
+                if (c == '@') {
+                    return fail(EmailError::MultipleAt);
+                }
+                if (c == '.') {
+                    if (state == LabelStart) {
+                        return fail(EmailError::EmptyDomainLabel);
+                    }
+                    domainHasDot = true;
+                    state = LabelStart;
+                } else if (c == '-') {
+                    state = Label;
+                } else {
+                    return fail(EmailError::InvalidCharacter);
+                }
+                return true;
+        }
+        return true;
     }
 
-    // If there are any errors, throw ValidationException
-    if (!errors.empty()) {
-        throw ValidationException(errors);
+    EmailError finish() {
+        if (error != EmailError::None) {
+            return error;
+        }
+        if (state == Local) {
+            return EmailError::MissingAt;
+        }
+        if (state == LabelStart) {
+            return EmailError::EmptyDomainLabel;
+        }
+        return domainHasDot ? EmailError::None : EmailError::MissingDomainDot;
     }
 
-    // Return sanitized credentials
-    return {sanitizedEmail, sanitizedPassword};
+private:
+    bool fail(EmailError found) {
+        error = found;
+        return false;
+    }
+};
+
+char toLowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
 }
 
-std::string sanitizeAndValidateEmail(const std::string& email) {
-    // Trim whitespace
-    std::string trimmed = email;
-    trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r\f\v"));
-    trimmed.erase(trimmed.find_last_not_of(" \t\n\r\f\v") + 1);
+// Lowercases in[0, n) into out and feeds it to the state machine
+bool scanEmailScalar(const char* in, char* out, size_t n, EmailStateMachine& machine) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = toLowerAscii(in[i]);
+        if (!machine.step(out[i])) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    // Convert to lowercase
-    std::string sanitized = trimmed;
-    std::transform(sanitized.begin(), sanitized.end(), sanitized.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
+#if defined(CPU_HAVE_X86_INTRINSICS) && defined(__SSE2__)
+#define USS_HAVE_SSE2 1
 
-    // TODO: validation
+// Lowercases 16 bytes and returns a bit mask of the ones that are not a
+// letter or digit. Bytes >= 0x80 compare as negative and end up in the mask.
+int lowercaseBlockSse2(const char* in, char* out) {
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)),
+                                        _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+    const __m128i lower = _mm_or_si128(c, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), lower);
+    const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(lower, _mm_set1_epi8('9' + 1)));
+    return ~_mm_movemask_epi8(_mm_or_si128(letter, digit)) & 0xFFFF;
+}
+
+#endif
 
+#ifdef CPU_HAVE_X86_INTRINSICS
+
+// Same as lowercaseBlockSse2 for 32 bytes
+__attribute__((target("avx2")))
+uint32_t lowercaseBlockAvx2(const char* in, char* out) {
+    const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+    const __m256i lower = _mm256_or_si256(c, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), lower);
+    const __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                            _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('0' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), lower));
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(letter, digit)));
+}
+
+#endif
+
+#ifdef CPU_HAVE_X86_INTRINSICS
+
+// Runs the state machine over a lowercased block whose special characters
+// are marked in mask; runs of letters and digits between them are skipped
+template<typename Mask>
+bool stepBlock(const char* lowered, size_t width, Mask mask, EmailStateMachine& machine) {
+    size_t position = 0;
+    while (mask != 0) {
+        const size_t special = static_cast<size_t>(__builtin_ctzll(static_cast<unsigned long long>(mask)));
+        machine.alnumRun(special - position);
+        if (!machine.step(lowered[special])) {
+            return false;
+        }
+        position = special + 1;
+        mask &= mask - 1;
+    }
+    machine.alnumRun(width - position);
+    return true;
+}
+
+#endif
+
+// Lowercases in[0, n) into out and validates it in the same pass. Wide
+// blocks are lowercased and classified with SIMD; only the characters that
+// can change the state (@ . - and invalid ones) go through step().
+EmailError scanEmail(const char* in, char* out, size_t n) {
+    EmailStateMachine machine;
+    size_t i = 0;
+#ifdef CPU_HAVE_X86_INTRINSICS
+    if (n >= 32 && hasAvx2()) {
+        for (; i + 32 <= n; i += 32) {
+            if (!stepBlock(out + i, 32, lowercaseBlockAvx2(in + i, out + i), machine)) {
+                return machine.finish();
+            }
+        }
+    }
+#endif
+#ifdef USS_HAVE_SSE2
+    for (; i + 16 <= n; i += 16) {
+        if (!stepBlock(out + i, 16, lowercaseBlockSse2(in + i, out + i), machine)) {
+            return machine.finish();
+        }
+    }
+#endif
+    scanEmailScalar(in + i, out + i, n - i, machine);
+    return machine.finish();
+}
+
+EmailError sanitizeEmailInto(std::string_view email, std::pmr::string& out) {
+    size_t begin = 0;
+    size_t end = email.size();
+    while (begin < end && isEmailSpace(email[begin])) {
+        begin++;
+    }
+    while (end > begin && isEmailSpace(email[end - 1])) {
+        end--;
+    }
+    const size_t length = end - begin;
+    if (length < minEmailLength) {
+        return EmailError::TooShort;
+    }
+    if (length > maxEmailLength) {
+        return EmailError::TooLong;
+    }
+    out.resize(length);
+    return scanEmail(email.data() + begin, out.data(), length);
+}
+
+}
+
+const char* trySanitizeAndValidateEmail(std::string_view email, std::pmr::string& out) {
+    const EmailError error = sanitizeEmailInto(email, out);
+    return error == EmailError::None ? nullptr : emailErrorMessage(error);
+}
+
+std::pmr::string sanitizeAndValidateEmail(std::string_view email, const RequestAllocator& alloc) {
+    std::pmr::string sanitized(alloc);
+    if (const char* error = trySanitizeAndValidateEmail(email, sanitized)) {
+        throw std::invalid_argument(error);
+    }
     return sanitized;
 }
 
-std::string sanitizeAndValidatePassword(const std::string& password) {
+const char* trySanitizeAndValidatePassword(std::string_view password, std::pmr::string& out) {
     // TODO: sanitization
     // TODO: validation
-    return password;
+    out.assign(password.data(), password.size());
+    return nullptr;
+}
+
+std::pmr::string sanitizeAndValidatePassword(std::string_view password, const RequestAllocator& alloc) {
+    std::pmr::string sanitized(alloc);
+    if (const char* error = trySanitizeAndValidatePassword(password, sanitized)) {
+        throw std::invalid_argument(error);
+    }
+    return sanitized;
 }
 
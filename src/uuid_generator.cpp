@@ -1,13 +1,58 @@
 #include "uuid_generator.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <random>
 #include <sstream>
 #include <iomanip>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/random.h>)
+#include <sys/random.h>
+#define USS_HAVE_GETRANDOM 1
+#endif
+#endif
 
 // Use a thread-local random engine for thread safety
 static thread_local std::random_device rd;
 static thread_local std::mt19937 generator(rd());
 static thread_local std::uniform_int_distribution<int> distribution(0, 15);
 
+// ============================================================================
+// UuidGenerator
+// ============================================================================
+
+void UuidGenerator::createInto(char* out, size_t n) {
+    const size_t len = length();
+    for (size_t i = 0; i < n; i++) {
+        std::string id = create();
+        if (id.size() != len) {
+            throw std::length_error("create() returned an ID that is not length() characters");
+        }
+        std::memcpy(out + i * len, id.data(), len);
+    }
+}
+
+std::vector<std::string> UuidGenerator::createBatch(size_t n) {
+    const size_t len = length();
+    std::string buffer(n * len, '\0');
+    createInto(buffer.data(), n);
+
+    std::vector<std::string> ids;
+    ids.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        ids.emplace_back(buffer, i * len, len);
+    }
+    return ids;
+}
+
+// ============================================================================
+// UuidGeneratorNaiveRandomImpl
+// ============================================================================
+
 std::string UuidGeneratorNaiveRandomImpl::create() {
     std::stringstream ss;
     for (int i = 0; i < 32; i++) {
@@ -21,3 +66,56 @@ std::string UuidGeneratorNaiveRandomImpl::createOne() {
     ss << std::hex << distribution(generator);
     return ss.str();
 }
+
+// ============================================================================
+// UuidGeneratorRandomImpl
+// ============================================================================
+
+std::string UuidGeneratorRandomImpl::create() {
+    std::string id(32, '\0');
+    createInto(id.data(), 1);
+    return id;
+}
+
+void UuidGeneratorRandomImpl::createInto(char* out, size_t n) {
+    auto& engine = threadLocalEngine<std::mt19937_64>();
+    uint64_t words[2];
+    uint8_t bytes[16];
+    for (size_t i = 0; i < n; i++) {
+        fillRandomWords(engine, words, 2);
+        storeBigEndian(words[0], bytes);
+        storeBigEndian(words[1], bytes + 8);
+        formatUuid<UuidFormatLower>(bytes, out);
+        out += 32;
+    }
+}
+
+// ============================================================================
+// fillSecureRandom
+// ============================================================================
+
+void fillSecureRandom(uint8_t* out, size_t n) {
+#ifdef USS_HAVE_GETRANDOM
+    while (n > 0) {
+        const ssize_t got = getrandom(out, n, 0);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "getrandom");
+        }
+        out += got;
+        n -= static_cast<size_t>(got);
+    }
+#else
+    std::FILE* source = std::fopen("/dev/urandom", "rb");
+    if (source == nullptr) {
+        throw std::system_error(errno, std::generic_category(), "open /dev/urandom");
+    }
+    const size_t got = std::fread(out, 1, n, source);
+    std::fclose(source);
+    if (got != n) {
+        throw std::system_error(EIO, std::generic_category(), "read /dev/urandom");
+    }
+#endif
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "async_repository.h"
+#include "pooled_sqlite_repository.h"
+#include "uss.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using ::testing::StrEq;
+using ::testing::Field;
+
+// ============================================================================
+// ExecutorRepository Tests
+// ============================================================================
+
+struct Book {
+    std::string isbn;
+    std::string title;
+};
+
+static const auto filterByIsbn = [](const Book& book, const std::string& isbn) {
+        return book.isbn == isbn;
+};
+
+// Simulates a lookup that waits on I/O and records how many run at once
+class SlowRepository : public IRepository<Book> {
+public:
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    std::optional<Book> get(const std::string& id) override {
+        const int now = ++running;
+        int seen = maxRunning.load();
+        while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        running--;
+        return Book{id, "Title " + id};
+    }
+};
+
+TEST(ExecutorRepositoryTest, ReturnsItemWhenFound) {
+    auto repo = std::make_shared<VectorRepository<Book>>(filterByIsbn, std::vector<Book>{{"123", "Necronomicon"}});
+    ExecutorRepository<Book> asyncRepo(repo, std::make_shared<ThreadPool>(2, 8));
+
+    auto result = asyncRepo.getAsync("123").get();
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(*result, Field(&Book::title, StrEq("Necronomicon")));
+    EXPECT_FALSE(asyncRepo.getAsync("999").get().has_value());
+}
+
+TEST(ExecutorRepositoryTest, RethrowsRepositoryExceptionFromTheFuture) {
+    ExecutorRepository<Book> asyncRepo(std::make_shared<ThrowingRepository<Book>>(), std::make_shared<ThreadPool>(1, 1));
+
+    auto result = asyncRepo.getAsync("123");
+
+    EXPECT_THROW(result.get(), RepositoryException);
+}
+
+TEST(ExecutorRepositoryTest, OverlapsConcurrentInFlightLookups) {
+    auto repo = std::make_shared<SlowRepository>();
+    ExecutorRepository<Book> asyncRepo(repo, std::make_shared<ThreadPool>(8, 16));
+    std::vector<std::string> ids;
+    for (int i = 0; i < 64; i++) {
+        ids.push_back(std::to_string(i));
+    }
+
+    auto results = asyncRepo.getManyAsync(ids);
+    for (size_t i = 0; i < results.size(); i++) {
+        auto book = results[i].get();
+        ASSERT_TRUE(book.has_value());
+        EXPECT_EQ(book->isbn, ids[i]);
+    }
+
+    // Each lookup sleeps 2 ms, long enough for the 8 workers' lookups to
+    // overlap; the counter shows it without timing the test
+    EXPECT_GT(repo->maxRunning.load(), 1);
+    EXPECT_LE(repo->maxRunning.load(), 8);
+}
+
+TEST(ExecutorRepositoryTest, ServesConcurrentCallersFromAPooledSqliteRepository) {
+    const auto path = (std::filesystem::temp_directory_path() / "async_repository_test.db").string();
+    std::remove(path.c_str());
+    sqlite3* db = nullptr;
+    sqlite3_open(path.c_str(), &db);
+    sqlite3_exec(db, "CREATE TABLE persons (id TEXT PRIMARY KEY, email TEXT NOT NULL, "
+                     "passwordHash TEXT NOT NULL, status TEXT NOT NULL)", nullptr, nullptr, nullptr);
+    sqlite3_close(db);
+
+    {
+        auto mapper = [](sqlite3_stmt* stmt) {
+            Person person;
+            person.id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+            person.email = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+            person.passwordHash = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+            person.status = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+            return person;
+        };
+        auto binder = [](sqlite3_stmt* stmt, const Person& person) {
+            sqlite3_bind_text(stmt, 1, person.id.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 2, person.email.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 3, person.passwordHash.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 4, person.status.c_str(), -1, SQLITE_TRANSIENT);
+        };
+        auto repo = std::make_shared<PooledSqliteRepository<Person>>(path, 4, "persons", mapper, "id");
+        std::vector<Person> persons;
+        for (int i = 0; i < 500; i++) {
+            persons.push_back({std::to_string(i), "user" + std::to_string(i) + "@example.com", "hash", "active"});
+        }
+        repo->insertMany(persons, binder);
+        ExecutorRepository<Person> asyncRepo(repo, std::make_shared<ThreadPool>(4, 32));
+
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> callers;
+        for (int t = 0; t < 4; t++) {
+            callers.emplace_back([&asyncRepo, &mismatches, t] {
+                std::vector<std::future<std::optional<Person>>> inFlight;
+                for (int i = t; i < 500; i += 4) {
+                    inFlight.push_back(asyncRepo.getAsync(std::to_string(i)));
+                }
+                for (int i = t, n = 0; i < 500; i += 4, n++) {
+                    auto person = inFlight[n].get();
+                    if (!person || std::string_view(person->email) != "user" + std::to_string(i) + "@example.com") {
+                        mismatches++;
+                    }
+                }
+            });
+        }
+        for (auto& caller : callers) {
+            caller.join();
+        }
+
+        EXPECT_EQ(mismatches.load(), 0);
+    }
+
+    std::remove(path.c_str());
+    std::remove((path + "-wal").c_str());
+    std::remove((path + "-shm").c_str());
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "big_unsigned.h"
+#include <random>
+#include <string>
+
+using ::testing::StrEq;
+
+namespace {
+
+BigUnsigned randomNumber(std::mt19937_64& random, size_t limbs) {
+    BigUnsigned value;
+    for (size_t i = 0; i < limbs; i++) {
+        value = (value << 64) + BigUnsigned(random() | 1);
+    }
+    return value;
+}
+
+std::string randomDigits(std::mt19937_64& random, size_t count) {
+    std::string digits(count, '0');
+    for (auto& digit : digits) {
+        digit = static_cast<char>('0' + random() % 10);
+    }
+    digits[0] = static_cast<char>('1' + random() % 9);
+    return digits;
+}
+
+}
+
+// ============================================================================
+// BigUnsigned Tests
+// ============================================================================
+
+TEST(BigUnsignedTest, ConvertsSmallValues) {
+    EXPECT_THAT(BigUnsigned().toString(), StrEq("0"));
+    EXPECT_THAT(BigUnsigned(42).toString(), StrEq("42"));
+    EXPECT_THAT(BigUnsigned(UINT64_MAX).toString(), StrEq("18446744073709551615"));
+    EXPECT_THAT((BigUnsigned(UINT64_MAX) + BigUnsigned(1)).toString(), StrEq("18446744073709551616"));
+}
+
+TEST(BigUnsignedTest, RoundTripsDecimalStringsOfEveryLength) {
+    std::mt19937_64 random(1);
+    for (size_t length : {1, 18, 19, 20, 38, 39, 77, 100, 1000, 5000, 20000}) {
+        const auto digits = randomDigits(random, length);
+        EXPECT_THAT(BigUnsigned::fromString(digits).toString(), StrEq(digits)) << "length " << length;
+    }
+    EXPECT_THAT(BigUnsigned::fromString("0000123").toString(), StrEq("123"));
+}
+
+TEST(BigUnsignedTest, ConvertsExactPowersOfTen) {
+    for (size_t zeros : {19, 38, 76, 152, 304}) {
+        const std::string power = "1" + std::string(zeros, '0');
+        EXPECT_THAT(BigUnsigned::fromString(power).toString(), StrEq(power));
+        const std::string below(zeros, '9');
+        EXPECT_THAT(BigUnsigned::fromString(below).toString(), StrEq(below));
+    }
+}
+
+TEST(BigUnsignedTest, RejectsInvalidStrings) {
+    EXPECT_THROW(BigUnsigned::fromString(""), std::invalid_argument);
+    EXPECT_THROW(BigUnsigned::fromString("12a"), std::invalid_argument);
+}
+
+TEST(BigUnsignedTest, KaratsubaMatchesSchoolbook) {
+    std::mt19937_64 random(2);
+    for (size_t a : {1, 31, 32, 33, 64, 100, 257}) {
+        for (size_t b : {1, 32, 50, 200}) {
+            const auto x = randomNumber(random, a);
+            const auto y = randomNumber(random, b);
+            EXPECT_EQ(x * y, BigUnsigned::multiplySchoolbook(x, y)) << a << " x " << b << " limbs";
+        }
+    }
+}
+
+TEST(BigUnsignedTest, AddsSubtractsAndShifts) {
+    const auto x = BigUnsigned::fromString("340282366920938463463374607431768211456");  // 2^128
+    EXPECT_EQ(BigUnsigned(1) << 128, x);
+    EXPECT_EQ(x >> 127, BigUnsigned(2));
+    EXPECT_THAT((x - BigUnsigned(1)).toString(), StrEq("340282366920938463463374607431768211455"));
+    EXPECT_EQ(x - x, BigUnsigned());
+    EXPECT_THROW(BigUnsigned(1) - x, std::underflow_error);
+    EXPECT_EQ(x.bitLength(), 129u);
+    EXPECT_EQ(x.mod(1000), 456u);
+}
@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "caching_repository.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::Throw;
+using ::testing::StrEq;
+using ::testing::Field;
+
+// ============================================================================
+// CachingRepository Tests
+// ============================================================================
+
+struct Account {
+    std::string id;
+    std::string email;
+};
+
+class MockAccountRepository : public IRepository<Account> {
+public:
+    MOCK_METHOD(std::optional<Account>, get, (const std::string& id), (override));
+};
+
+// Clock that only moves when the test advances it
+struct ManualClock {
+    std::shared_ptr<std::chrono::steady_clock::time_point> now =
+        std::make_shared<std::chrono::steady_clock::time_point>();
+
+    CachingRepository<Account>::Clock clock() const {
+        auto time = now;
+        return [time] { return *time; };
+    }
+
+    void advance(std::chrono::milliseconds by) {
+        *now += by;
+    }
+};
+
+class CachingRepositoryTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockAccountRepository> backend = std::make_shared<MockAccountRepository>();
+    ManualClock time;
+    CachingRepositoryOptions options;
+
+    void SetUp() override {
+        options.capacity = 100;
+        options.shardCount = 4;
+        options.ttl = std::chrono::milliseconds(1000);
+        options.negativeTtl = std::chrono::milliseconds(100);
+    }
+
+    CachingRepository<Account> makeCache() {
+        return CachingRepository<Account>(backend, options, time.clock());
+    }
+};
+
+TEST_F(CachingRepositoryTest, ServesRepeatedLookupsFromTheCache) {
+    EXPECT_CALL(*backend, get("42"))
+        .Times(1)
+        .WillOnce(Return(Account{"42", "alice@example.com"}));
+    auto cache = makeCache();
+
+    cache.get("42");
+    auto result = cache.get("42");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(*result, Field(&Account::email, StrEq("alice@example.com")));
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_DOUBLE_EQ(cache.stats().hitRate(), 0.5);
+}
+
+TEST_F(CachingRepositoryTest, ReloadsAfterTheTtlExpires) {
+    EXPECT_CALL(*backend, get("42"))
+        .Times(2)
+        .WillRepeatedly(Return(Account{"42", "alice@example.com"}));
+    auto cache = makeCache();
+
+    cache.get("42");
+    time.advance(std::chrono::milliseconds(999));
+    cache.get("42");
+    time.advance(std::chrono::milliseconds(1));
+    cache.get("42");
+}
+
+TEST_F(CachingRepositoryTest, CachesNotFoundForTheNegativeTtl) {
+    EXPECT_CALL(*backend, get("unknown"))
+        .Times(2)
+        .WillRepeatedly(Return(std::nullopt));
+    auto cache = makeCache();
+
+    EXPECT_FALSE(cache.get("unknown").has_value());
+    EXPECT_FALSE(cache.get("unknown").has_value());
+    time.advance(std::chrono::milliseconds(100));
+    EXPECT_FALSE(cache.get("unknown").has_value());
+
+    EXPECT_EQ(cache.stats().negativeHits, 1u);
+}
+
+TEST_F(CachingRepositoryTest, EvictsTheLeastRecentlyUsedEntry) {
+    options.capacity = 2;
+    options.shardCount = 1;
+    EXPECT_CALL(*backend, get(_))
+        .WillRepeatedly(Invoke([](const std::string& id) { return Account{id, id + "@example.com"}; }));
+    EXPECT_CALL(*backend, get("b")).Times(2).WillRepeatedly(Return(Account{"b", "b@example.com"}));
+    auto cache = makeCache();
+
+    cache.get("a");
+    cache.get("b");
+    cache.get("a");  // b is now the least recently used
+    cache.get("c");  // evicts b
+    cache.get("a");
+    cache.get("b");
+
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(CachingRepositoryTest, InvalidateForcesAReload) {
+    EXPECT_CALL(*backend, get("42"))
+        .Times(2)
+        .WillRepeatedly(Return(Account{"42", "alice@example.com"}));
+    auto cache = makeCache();
+
+    cache.get("42");
+    cache.invalidate("42");
+    cache.get("42");
+}
+
+TEST_F(CachingRepositoryTest, PropagatesBackendExceptionsWithoutCachingThem) {
+    EXPECT_CALL(*backend, get("42"))
+        .WillOnce(Throw(RepositoryException("Database error")))
+        .WillOnce(Return(Account{"42", "alice@example.com"}));
+    auto cache = makeCache();
+
+    EXPECT_THROW(cache.get("42"), RepositoryException);
+    EXPECT_TRUE(cache.get("42").has_value());
+}
+
+TEST_F(CachingRepositoryTest, CollapsesConcurrentMissesIntoOneBackendCall) {
+    std::mutex mutex;
+    std::condition_variable released;
+    bool release = false;
+    std::atomic<int> backendCalls{0};
+    EXPECT_CALL(*backend, get("42"))
+        .WillRepeatedly(Invoke([&](const std::string& id) {
+            backendCalls++;
+            std::unique_lock<std::mutex> lock(mutex);
+            released.wait(lock, [&] { return release; });
+            return std::optional<Account>(Account{id, "alice@example.com"});
+        }));
+    auto cache = makeCache();
+
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.emplace_back([&] {
+            if (cache.get("42")) {
+                found++;
+            }
+        });
+    }
+    // Give the other threads time to queue up behind the first backend call
+    while (backendCalls == 0) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    released.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(backendCalls.load(), 1);
+    EXPECT_EQ(found.load(), 8);
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits + stats.coalesced, 7u);
+}
+
+TEST_F(CachingRepositoryTest, InvalidateDuringALoadKeepsTheStaleRowOutOfTheCache) {
+    std::mutex mutex;
+    std::condition_variable released;
+    bool release = false;
+    std::atomic<int> backendCalls{0};
+    EXPECT_CALL(*backend, get("42"))
+        .WillOnce(Invoke([&](const std::string& id) {
+            backendCalls++;
+            std::unique_lock<std::mutex> lock(mutex);
+            released.wait(lock, [&] { return release; });
+            return std::optional<Account>(Account{id, "old@example.com"});
+        }))
+        .WillOnce(Return(Account{"42", "new@example.com"}));
+    auto cache = makeCache();
+
+    std::optional<Account> stale;
+    std::thread loader([&] { stale = cache.get("42"); });
+    while (backendCalls == 0) {
+        std::this_thread::yield();
+    }
+    // The row is written while the old one is being read
+    cache.invalidate("42");
+
+    // Doesn't join the detached load
+    auto fresh = cache.get("42");
+    ASSERT_TRUE(fresh.has_value());
+    EXPECT_THAT(fresh->email, StrEq("new@example.com"));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    released.notify_all();
+    loader.join();
+
+    ASSERT_TRUE(stale.has_value());
+    EXPECT_THAT(stale->email, StrEq("old@example.com"));
+    auto cached = cache.get("42");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_THAT(cached->email, StrEq("new@example.com"));
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+TEST_F(CachingRepositoryTest, RejectsZeroCapacity) {
+    options.capacity = 0;
+
+    EXPECT_THROW(makeCache(), std::invalid_argument);
+}
+
+// ============================================================================
+// CachingRepository over ThrowingRepository
+// ============================================================================
+
+TEST(CachingThrowingRepositoryTest, PropagatesTheException) {
+    CachingRepository<Account> cache(std::make_shared<ThrowingRepository<Account>>());
+
+    EXPECT_THROW(cache.get("42"), RepositoryException);
+    EXPECT_THROW(cache.get("42"), RepositoryException);
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "credentials_batch.h"
+#include <future>
+#include <string>
+#include <vector>
+
+using ::testing::StrEq;
+using ::testing::AllOf;
+using ::testing::Field;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+// ============================================================================
+// Batch Validation Tests
+// ============================================================================
+
+namespace {
+
+// Every third item has an invalid email
+std::vector<Credentials> makeBatch(size_t count) {
+    std::vector<Credentials> batch;
+    for (size_t i = 0; i < count; i++) {
+        if (i % 3 == 2) {
+            batch.emplace_back("invalid-" + std::to_string(i), "Passw0rd.123");
+        } else {
+            batch.emplace_back("  User" + std::to_string(i) + "@Example.COM ", "Passw0rd.123");
+        }
+    }
+    return batch;
+}
+
+void expectMatchesSingleValidation(const std::vector<Credentials>& batch, const CredentialsBatchResult& result) {
+    ASSERT_EQ(result.size(), batch.size());
+    for (size_t i = 0; i < batch.size(); i++) {
+        const auto single = validateCredentials(batch[i]);
+        ASSERT_EQ(result.ok(i), single.ok()) << "item " << i;
+        if (single.ok()) {
+            EXPECT_THAT(result.value(i).email, StrEq(single.value().email)) << "item " << i;
+            EXPECT_THAT(result.value(i).plainPassword, StrEq(single.value().plainPassword)) << "item " << i;
+        } else {
+            const auto errors = result.errors(i);
+            ASSERT_EQ(errors.size(), single.errors().size()) << "item " << i;
+            for (size_t e = 0; e < errors.size(); e++) {
+                EXPECT_THAT(errors[e].field, StrEq(single.errors()[e].field)) << "item " << i;
+                EXPECT_THAT(errors[e].message, StrEq(single.errors()[e].message)) << "item " << i;
+            }
+        }
+    }
+}
+
+}
+
+TEST(ValidateBatchTest, MatchesValidateCredentialsPerItem) {
+    const auto batch = makeBatch(30);
+    CredentialsBatchResult result;
+
+    validateBatch(batch, result);
+
+    expectMatchesSingleValidation(batch, result);
+    EXPECT_EQ(result.validCount(), 20u);
+}
+
+TEST(ValidateBatchTest, ReportsPerItemErrors) {
+    const std::vector<Credentials> batch = {
+        {"test@example.com", "Passw0rd.123"},
+        {"missing@tld", "Passw0rd.123"},
+    };
+    CredentialsBatchResult result;
+
+    validateBatch(batch, result);
+
+    EXPECT_THAT(result.errors(0), IsEmpty());
+    EXPECT_EQ(result.passwordError(1), nullptr);
+    EXPECT_THAT(result.errors(1), ElementsAre(AllOf(
+        Field(&ValidationError::field, StrEq("email")),
+        Field(&ValidationError::message, StrEq("Email domain must contain ."))
+    )));
+}
+
+TEST(ValidateBatchTest, ReusesTheOutputBuffers) {
+    const std::vector<Credentials> first = {{"a-rather-long-local-part@example.com", "Passw0rd.123"}};
+    const std::vector<Credentials> second = {{"short@example.com", "Passw0rd.123"}};
+    CredentialsBatchResult result;
+
+    validateBatch(first, result);
+    const char* buffer = result.value(0).email.data();
+    validateBatch(second, result);
+
+    EXPECT_EQ(result.value(0).email.data(), buffer);
+    EXPECT_THAT(result.value(0).email, StrEq("short@example.com"));
+}
+
+TEST(ValidateBatchTest, SmallerBatchShrinksTheResult) {
+    CredentialsBatchResult result;
+    result.reserve(100);
+
+    validateBatch(makeBatch(10), result);
+    EXPECT_EQ(result.size(), 10u);
+
+    validateBatch(makeBatch(0), result);
+    EXPECT_EQ(result.size(), 0u);
+    EXPECT_EQ(result.validCount(), 0u);
+}
+
+TEST(ValidateBatchTest, ParallelBatchMatchesSerialValidation) {
+    ThreadPool pool(4, 16);
+    const auto batch = makeBatch(1001);
+    CredentialsBatchResult result;
+
+    validateBatch(batch, result, &pool, 50);
+
+    expectMatchesSingleValidation(batch, result);
+}
+
+TEST(ValidateBatchTest, BatchBelowTheTaskSizeRunsOnTheCallingThread) {
+    ThreadPool pool(1, 1);
+    const auto batch = makeBatch(10);
+    CredentialsBatchResult result;
+
+    // The only worker is blocked, so a submitted chunk would never finish
+    std::promise<void> release;
+    auto blocker = pool.submit([future = release.get_future().share()] { future.wait(); });
+    validateBatch(batch, result, &pool, 256);
+    release.set_value();
+    blocker.get();
+
+    expectMatchesSingleValidation(batch, result);
+}
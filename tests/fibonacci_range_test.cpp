@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "fibonacci.h"
+#include "fibonacci_range.h"
+#include <future>
+#include <iterator>
+#include <vector>
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace {
+
+std::vector<uint64_t> expectedRange(uint64_t first, size_t count, uint64_t modulus) {
+    std::vector<uint64_t> expected;
+    for (size_t i = 0; i < count; i++) {
+        expected.push_back(Fibonacci().calcMod(first + i, modulus));
+    }
+    return expected;
+}
+
+}
+
+TEST(FibonacciRangeTest, FillsTheBufferFromTheFirstIndex) {
+    std::vector<uint64_t> out(8);
+    auto end = fibonacciModRange(10, out.size(), UINT64_MAX, out.data());
+
+    EXPECT_EQ(end, out.data() + out.size());
+    EXPECT_THAT(out, ElementsAre(55, 89, 144, 233, 377, 610, 987, 1597));
+}
+
+TEST(FibonacciRangeTest, MatchesCalcModAcrossChunks) {
+    const uint64_t first = 1000000000000ULL;
+    std::vector<uint64_t> out(1000);
+    fibonacciModRange(first, out.size(), 1000000007, out.data(), nullptr, 64);
+
+    EXPECT_EQ(out, expectedRange(first, out.size(), 1000000007));
+}
+
+TEST(FibonacciRangeTest, ParallelRangeMatchesSerialRange) {
+    ThreadPool pool(3, 16);
+    const uint64_t first = 123456789;
+    std::vector<uint64_t> serial(10007);
+    std::vector<uint64_t> parallel(serial.size());
+
+    fibonacciModRange(first, serial.size(), 998244353, serial.data());
+    fibonacciModRange(first, parallel.size(), 998244353, parallel.data(), &pool, 100);
+
+    EXPECT_EQ(parallel, serial);
+    EXPECT_EQ(parallel[5000], Fibonacci().calcMod(first + 5000, 998244353));
+}
+
+TEST(FibonacciRangeTest, FullQueueLeavesTheWorkToTheCallingThread) {
+    ThreadPool pool(1, 1);
+    std::promise<void> release;
+    auto blocker = pool.submit([future = release.get_future().share()] { future.wait(); });
+    auto queued = pool.submit([] {});
+    std::vector<uint64_t> out(500);
+
+    fibonacciModRange(0, out.size(), 1000, out.data(), &pool, 10);
+    release.set_value();
+
+    EXPECT_EQ(out, expectedRange(0, out.size(), 1000));
+}
+
+TEST(FibonacciRangeTest, StreamsToAnOutputIterator) {
+    ThreadPool pool(2, 8);
+    std::vector<uint64_t> out;
+    // Buffers of 3 * 64 numbers, one chunk for each worker and the caller
+    fibonacciModRange(7, 1000, 65536, std::back_inserter(out), &pool, 64, 100);
+
+    EXPECT_EQ(out, expectedRange(7, 1000, 65536));
+}
+
+TEST(FibonacciRangeTest, StreamingBufferHoldsAChunkForEveryThread) {
+    ThreadPool pool(7, 16);
+
+    EXPECT_EQ(fibonacci_detail::streamBufferSize(nullptr, 16384, 100), 100u);
+    EXPECT_EQ(fibonacci_detail::streamBufferSize(nullptr, 16384, 0), 1u);
+    EXPECT_EQ(fibonacci_detail::streamBufferSize(&pool, 16384, 65536), 8u * 16384);
+    EXPECT_EQ(fibonacci_detail::streamBufferSize(&pool, 1000, 65536), 65536u);
+    EXPECT_EQ(fibonacci_detail::streamBufferSize(&pool, 0, 0), 8u);
+}
+
+TEST(FibonacciRangeTest, ReachesTheLargestIndex) {
+    std::vector<uint64_t> out;
+    fibonacciModRange(UINT64_MAX - 2, 3, 1000000007, std::back_inserter(out));
+
+    EXPECT_EQ(out, expectedRange(UINT64_MAX - 2, 3, 1000000007));
+}
+
+TEST(FibonacciRangeTest, HandlesEmptyRanges) {
+    std::vector<uint64_t> out;
+    fibonacciModRange(UINT64_MAX, 0, 10, std::back_inserter(out));
+
+    EXPECT_THAT(out, IsEmpty());
+}
+
+TEST(FibonacciRangeTest, ThrowsExceptionForInvalidRanges) {
+    std::vector<uint64_t> out(2);
+    EXPECT_THROW(fibonacciModRange(0, out.size(), 0, out.data()), std::invalid_argument);
+    EXPECT_THROW(fibonacciModRange(UINT64_MAX, out.size(), 10, out.data()), std::invalid_argument);
+    EXPECT_THROW(fibonacciModRange(UINT64_MAX, 2, 10, std::back_inserter(out)), std::invalid_argument);
+    EXPECT_EQ(out.size(), 2u);
+}
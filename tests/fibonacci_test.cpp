@@ -12,7 +12,7 @@ using ::testing::Eq;
 // Basic test - this will fail until implemented
 // ============================================================================
 
-TEST(FibonacciTest,  DISABLED_ReturnZeroForIndexZero) {
+TEST(FibonacciTest,  ReturnZeroForIndexZero) {
     // given / Arrange
     Fibonacci fib;
     int index = 0;
@@ -32,32 +32,204 @@ TEST(FibonacciTest,  DISABLED_ReturnZeroForIndexZero) {
     ASSERT_EQ(fib.calc(0), 0) << "It should yield zero for index zero IV";
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsOneForIndexOne) {
+TEST(FibonacciTest, ReturnsOneForIndexOne) {
+    EXPECT_EQ(Fibonacci().calc(1), 1);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsOneForIndexTwo) {
+TEST(FibonacciTest, ReturnsOneForIndexTwo) {
+    EXPECT_EQ(Fibonacci().calc(2), 1);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsTwoForIndexThree) {
+TEST(FibonacciTest, ReturnsTwoForIndexThree) {
+    EXPECT_EQ(Fibonacci().calc(3), 2);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsThreeForIndexFour) {
+TEST(FibonacciTest, ReturnsThreeForIndexFour) {
+    EXPECT_EQ(Fibonacci().calc(4), 3);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsFiveForIndexFive) {
+TEST(FibonacciTest, ReturnsFiveForIndexFive) {
+    EXPECT_EQ(Fibonacci().calc(5), 5);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsEightForIndexSix) {
+TEST(FibonacciTest, ReturnsEightForIndexSix) {
+    EXPECT_EQ(Fibonacci().calc(6), 8);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsCorrectValueForSmallIndices) {
+TEST(FibonacciTest, ReturnsCorrectValueForSmallIndices) {
+    Fibonacci fib;
+    EXPECT_EQ(fib.calc(10), 55);
+    EXPECT_EQ(fib.calc(20), 6765);
+    EXPECT_EQ(fib.calc(30), 832040);
+}
+
+TEST(FibonacciTest, ReturnsCorrectValueForLargeIndices) {
+    Fibonacci fib;
+    EXPECT_EQ(fib.calc(50), 12586269025LL);
+    EXPECT_EQ(fib.calc(90), 2880067194370816120LL);
+    EXPECT_EQ(fib.calc(92), 7540113804746346429LL);
+}
+
+TEST(FibonacciTest, ThrowsExceptionForNegativeIndices) {
+    EXPECT_THROW(Fibonacci().calc(-1), std::invalid_argument);
+}
+
+TEST(FibonacciTest, ThrowsExceptionForIndicesTooLarge) {
+    EXPECT_THROW(Fibonacci().calc(93), std::overflow_error);
+}
+
+TEST(FibonacciTest, EvaluatesAtCompileTime) {
+    static_assert(Fibonacci().calc(92) == 7540113804746346429LL);
+    static_assert(Fibonacci().calc(12) == 144);
+}
+
+// ============================================================================
+// Modular fast doubling
+// ============================================================================
+
+TEST(FibonacciModTest, MatchesTheTableBelowTheModulus) {
+    Fibonacci fib;
+    for (int i = 0; i <= Fibonacci::maxIndex; i++) {
+        EXPECT_EQ(fib.calcMod(i, UINT64_MAX), static_cast<uint64_t>(fib.calc(i))) << "index " << i;
+        EXPECT_EQ(fib.calcMod(i, 1000000007), static_cast<uint64_t>(fib.calc(i)) % 1000000007) << "index " << i;
+    }
+}
+
+TEST(FibonacciModTest, HandlesHugeIndices) {
+    Fibonacci fib;
+    // The Pisano period of 10 is 60
+    EXPECT_EQ(fib.calcMod(1000000000000000000ULL, 10), fib.calcMod(1000000000000000000ULL % 60, 10));
+    // F(10^18) mod (10^9 + 7), a known reference value
+    EXPECT_EQ(fib.calcMod(1000000000000000000ULL, 1000000007), 209783453u);
+    EXPECT_EQ(fib.calcMod(12345, 1), 0u);
+}
+
+TEST(FibonacciModTest, ThrowsExceptionForZeroModulus) {
+    EXPECT_THROW(Fibonacci().calcMod(5, 0), std::invalid_argument);
+}
+
+// ============================================================================
+// Modular batches and Pisano periods
+// ============================================================================
+
+namespace {
+
+std::vector<uint64_t> batchIndices() {
+    // Small, large and mixed-length indices, not a multiple of the lane count
+    std::vector<uint64_t> indices = {0, 1, 2, 3, 92, 93, 1000000000000000000ULL, UINT64_MAX, 5};
+    uint64_t x = 88172645463325252ULL;
+    for (int i = 0; i < 200; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        indices.push_back(x >> (i % 64));
+    }
+    return indices;
+}
+
+}
+
+TEST(FibonacciModBatchTest, MatchesCalcModForEveryKindOfModulus) {
+    Fibonacci fib;
+    const auto indices = batchIndices();
+    // Odd below 2^32 (Montgomery), even below 2^32 (Barrett), and 2^32 and above (calcMod)
+    for (uint64_t modulus : std::vector<uint64_t>{1, 2, 3, 10, 1000000007, 4294967291, 4294967295, 4294967294,
+                                                   4294967296, 1000000000000000000ULL, UINT64_MAX}) {
+        const auto actual = fib.calcModBatch(indices, modulus);
+        ASSERT_EQ(actual.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            EXPECT_EQ(actual[i], fib.calcMod(indices[i], modulus)) << "index " << indices[i] << " modulus " << modulus;
+        }
+    }
+}
+
+TEST(FibonacciModBatchTest, HandlesEmptyBatches) {
+    EXPECT_THAT(Fibonacci().calcModBatch(std::vector<uint64_t>{}, 7), IsEmpty());
+}
+
+TEST(FibonacciModBatchTest, ThrowsExceptionForZeroModulus) {
+    EXPECT_THROW(Fibonacci().calcModBatch(std::vector<uint64_t>{1, 2}, 0), std::invalid_argument);
+}
+
+TEST(FibonacciModBatchTest, UsesTheCacheForSmallModuli) {
+    Fibonacci fib;
+    PisanoCache cache(1000, 2);
+    const auto indices = batchIndices();
+
+    for (uint64_t modulus : {10ULL, 997ULL, 1000ULL, 1001ULL}) {
+        const auto actual = fib.calcModBatch(indices, modulus, &cache);
+        for (size_t i = 0; i < indices.size(); i++) {
+            EXPECT_EQ(actual[i], fib.calcMod(indices[i], modulus)) << "index " << indices[i] << " modulus " << modulus;
+        }
+    }
+    // 1001 is above maxModulus, and the table for 10 was dropped for 1000
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.table(1001), nullptr);
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(PisanoCacheTest, ComputesKnownPeriods) {
+    EXPECT_EQ(PisanoCache::period(1), 1u);
+    EXPECT_EQ(PisanoCache::period(2), 3u);
+    EXPECT_EQ(PisanoCache::period(10), 60u);
+    EXPECT_EQ(PisanoCache::period(1000), 1500u);
+    EXPECT_THROW(PisanoCache::period(0), std::invalid_argument);
 }
 
-TEST(FibonacciTest, DISABLED_ReturnsCorrectValueForLargeIndices) {
+TEST(PisanoCacheTest, BuildsOnePeriodOfResidues) {
+    PisanoCache cache;
+    const auto table = cache.table(10);
+    ASSERT_NE(table, nullptr);
+    ASSERT_EQ(table->size(), 60u);
+    EXPECT_EQ((*table)[7], 3u);
+    EXPECT_EQ((*table)[59], 1u);
+    EXPECT_EQ(cache.table(10), table);
 }
 
-TEST(FibonacciTest, DISABLED_ThrowsExceptionForNegativeIndices) {
+TEST(PisanoCacheTest, RejectsModuliWhoseTablesWouldBeTooLarge) {
+    EXPECT_NO_THROW(PisanoCache(PisanoCache::modulusLimit));
+    EXPECT_THROW(PisanoCache(PisanoCache::modulusLimit + 1), std::invalid_argument);
+    EXPECT_THROW(PisanoCache(uint64_t{1} << 32), std::invalid_argument);
+    EXPECT_THROW(PisanoCache(1000, 0), std::invalid_argument);
 }
 
-TEST(FibonacciTest, DISABLED_ThrowsExceptionForIndicesTooLarge) {
+// ============================================================================
+// Arbitrary precision
+// ============================================================================
+
+TEST(FibonacciBigTest, MatchesTheTable) {
+    Fibonacci fib;
+    for (int i = 0; i <= Fibonacci::maxIndex; i++) {
+        EXPECT_EQ(fib.calcBig(i), BigUnsigned(static_cast<uint64_t>(fib.calc(i)))) << "index " << i;
+    }
+}
+
+TEST(FibonacciBigTest, ReturnsCorrectValuePastInt64) {
+    Fibonacci fib;
+    EXPECT_THAT(fib.calcBig(93).toString(), Eq("12200160415121876738"));
+    EXPECT_THAT(fib.calcBig(100).toString(), Eq("354224848179261915075"));
+    EXPECT_THAT(fib.calcBig(200).toString(), Eq("280571172992510140037611932413038677189525"));
+}
+
+TEST(FibonacciBigTest, MatchesAdditionAndTheModularPath) {
+    Fibonacci fib;
+    BigUnsigned a;
+    BigUnsigned b(1);
+    for (uint64_t i = 0; i <= 3000; i++) {
+        if (i % 500 == 0) {
+            EXPECT_EQ(fib.calcBig(i), a) << "index " << i;
+        }
+        b = a + b;
+        a = b - a;
+    }
+    const auto big = fib.calcBig(100000);
+    EXPECT_EQ(big.mod(1000000007), fib.calcMod(100000, 1000000007));
+}
+
+TEST(FibonacciBigTest, HandlesIndexOneMillion) {
+    Fibonacci fib;
+    const auto digits = fib.calcBig(1000000).toString();
+
+    EXPECT_EQ(digits.size(), 208988u);
+    EXPECT_EQ(digits.substr(digits.size() - 19), std::to_string(fib.calcMod(1000000, 10000000000000000000ULL)));
 }
@@ -16,42 +16,94 @@ using ::testing::ElementsAre;
 using ::testing::Return;
 using ::testing::_;
 using ::testing::Throw;
+using ::testing::SizeIs;
+using ::testing::Ne;
 
 
 static const Credentials invalidCredentials = {"", ""};
 
-/* static PersonRepository* repo = new VectorRepository<Person>(
-        [](const Person& p, const std::string& email) { return p.email == email; },
-        {
-            {existingUsersId, validEmail, validPassword, "active"}
+static const std::string existingUsersId = "123";
+static const std::string validEmail = "test@example.com";
+static const std::string validPassword = "Passw0rd.123";
+
+// A low cost keeps the tests fast; the service reads the cost from the hash
+static std::shared_ptr<PasswordHasher> makeHasher() {
+    return std::make_shared<Pbkdf2PasswordHasher>(10);
+}
+
+static std::shared_ptr<PersonRepository> makeRepository(const std::string& status = "active") {
+    return std::make_shared<VectorRepository<Person>>(
+        [](const Person& p, const std::string& email) { return std::string_view(p.email) == email; },
+        std::vector<Person>{
+            {existingUsersId, validEmail, makeHasher()->hash(validPassword), status}
         }
-); */
+    );
+}
+
+static auto throwsLoginException(const std::string& message) {
+    return Throws<LoginException>(Property(&LoginException::what, StrEq(message)));
+}
 
 class LoginServiceTest : public ::testing::Test {
 protected:
     std::shared_ptr<LoginService> service;
 
     void SetUp() override {
-        service = std::make_shared<LoginService>();
+        service = makeService(makeRepository());
+    }
+
+    // mt19937_64-based IDs are predictable, which is fine for tests only
+    static std::shared_ptr<LoginService> makeService(std::shared_ptr<PersonRepository> repository) {
+        return std::make_shared<LoginService>(repository, makeHasher(), std::make_shared<UuidGeneratorSecureV4<>>());
     }
 };
 
-TEST_F(LoginServiceTest, DISABLED_LoginWithInvalidCredentialsThrows) {
+TEST_F(LoginServiceTest, LoginWithInvalidCredentialsThrows) {
     auto action = [this] { service->login(invalidCredentials); };
     EXPECT_THAT(action, Throws<ValidationException>());
 }
 
-TEST_F(LoginServiceTest, DISABLED_LoginWithUnknownEmailThrows) {
+TEST_F(LoginServiceTest, LoginWithUnknownEmailThrows) {
+    auto action = [this] { service->login({"unknown@example.com", validPassword}); };
+    EXPECT_THAT(action, throwsLoginException(LoginService::invalidCredentialsMessage));
 }
 
-TEST_F(LoginServiceTest, DISABLED_LoginWithWrongPasswordThrows) {
+TEST_F(LoginServiceTest, LoginWithWrongPasswordThrows) {
+    auto action = [this] { service->login({validEmail, "Wrong.Passw0rd"}); };
+    EXPECT_THAT(action, throwsLoginException(LoginService::invalidCredentialsMessage));
 }
 
-TEST_F(LoginServiceTest, DISABLED_LoginFailsOnDbError) {
+TEST_F(LoginServiceTest, LoginWithInactiveAccountThrows) {
+    service = makeService(makeRepository("locked"));
+    auto action = [this] { service->login({validEmail, validPassword}); };
+    EXPECT_THAT(action, throwsLoginException(LoginService::inactiveAccountMessage));
 }
 
+TEST_F(LoginServiceTest, LoginWithInactiveAccountAndWrongPasswordHidesTheStatus) {
+    service = makeService(makeRepository("locked"));
+    auto action = [this] { service->login({validEmail, "Wrong.Passw0rd"}); };
+    EXPECT_THAT(action, throwsLoginException(LoginService::invalidCredentialsMessage));
+}
 
-TEST_F(LoginServiceTest, DISABLED_LoginOK) {
+TEST_F(LoginServiceTest, LoginFailsOnDbError) {
+    service = makeService(std::make_shared<ThrowingRepository<Person>>());
+    auto action = [this] { service->login({validEmail, validPassword}); };
+    EXPECT_THAT(action, Throws<ServerException>());
+}
+
+
+TEST_F(LoginServiceTest, LoginOK) {
+    const auto session = service->login({"  TEST@Example.com ", validPassword});
+
+    EXPECT_THAT(session.userId, StrEq(existingUsersId));
+    EXPECT_THAT(session.sessionId, SizeIs(32));
+}
+
+TEST_F(LoginServiceTest, EveryLoginGetsANewSessionId) {
+    const auto first = service->login({validEmail, validPassword});
+    const auto second = service->login({validEmail, validPassword});
+
+    EXPECT_THAT(first.sessionId, Ne(second.sessionId));
 }
 
 
@@ -61,5 +113,20 @@ public:
     MOCK_METHOD(std::optional<Person>, get, (const std::string& id), (override));
 };
 
-TEST_F(LoginServiceTest, DISABLED_LoginFailsOnDbErrorViaMock) {
-}
\ No newline at end of file
+TEST_F(LoginServiceTest, LoginFailsOnDbErrorViaMock) {
+    auto repository = std::make_shared<MockPersonRepository>();
+    EXPECT_CALL(*repository, get(validEmail)).WillOnce(Throw(RepositoryException("Database error")));
+    service = makeService(repository);
+
+    auto action = [this] { service->login({"Test@Example.com", validPassword}); };
+    EXPECT_THAT(action, Throws<ServerException>());
+}
+
+TEST_F(LoginServiceTest, LooksUpTheSanitizedEmailViaMock) {
+    auto repository = std::make_shared<MockPersonRepository>();
+    EXPECT_CALL(*repository, get(validEmail)).WillOnce(Return(std::nullopt));
+    service = makeService(repository);
+
+    auto action = [this] { service->login({" TEST@EXAMPLE.COM ", validPassword}); };
+    EXPECT_THAT(action, Throws<LoginException>());
+}
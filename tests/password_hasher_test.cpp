@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "password_hasher.h"
+#include <future>
+#include <string>
+#include <vector>
+
+using ::testing::StartsWith;
+using ::testing::Not;
+using ::testing::Eq;
+
+namespace {
+
+std::string hex(const uint8_t* bytes, size_t length) {
+    static const char digits[] = "0123456789abcdef";
+    std::string result;
+    for (size_t i = 0; i < length; i++) {
+        result += digits[bytes[i] >> 4];
+        result += digits[bytes[i] & 0x0f];
+    }
+    return result;
+}
+
+// Blocks inside verify() until released, to fill the pool on demand
+class GateHasher : public PasswordHasher {
+public:
+    std::shared_future<void> gate;
+
+    explicit GateHasher(std::shared_future<void> released) : gate(std::move(released)) {}
+
+    std::string hash(std::string_view password) override {
+        gate.wait();
+        return std::string(password);
+    }
+
+    bool verify(std::string_view password, std::string_view encodedHash) override {
+        gate.wait();
+        return password == encodedHash;
+    }
+};
+
+}
+
+// ============================================================================
+// Primitive Tests
+// ============================================================================
+
+TEST(Sha256Test, MatchesKnownDigests) {
+    auto digest = sha256("");
+    EXPECT_EQ(hex(digest.data(), digest.size()), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    digest = sha256("abc");
+    EXPECT_EQ(hex(digest.data(), digest.size()), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    digest = sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq");
+    EXPECT_EQ(hex(digest.data(), digest.size()), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Pbkdf2Test, MatchesKnownVectors) {
+    auto key = pbkdf2HmacSha256("password", "salt", 1, 32);
+    EXPECT_EQ(hex(key.data(), key.size()), "120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b");
+    key = pbkdf2HmacSha256("password", "salt", 2, 32);
+    EXPECT_EQ(hex(key.data(), key.size()), "ae4d0c95af6b46d32d0adff928f06dd02a303f8ef3c251dfd6e2d85a95474c43");
+    key = pbkdf2HmacSha256("password", "salt", 4096, 32);
+    EXPECT_EQ(hex(key.data(), key.size()), "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a");
+}
+
+TEST(Pbkdf2Test, DerivesKeysLongerThanOneBlockWithLongPasswords) {
+    const auto key = pbkdf2HmacSha256("passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 40);
+    EXPECT_EQ(hex(key.data(), key.size()),
+              "348c89dbcbd32b2f32d814b8116e84cf2b17347ebc1800181c4e2a1fb8dd53e1c635518c7dac47e9");
+    const auto longPassword = pbkdf2HmacSha256(std::string(100, 'p'), "salt", 1, 32);
+    EXPECT_EQ(longPassword.size(), 32u);
+}
+
+TEST(ConstantTimeEqualsTest, ComparesContentAndLength) {
+    EXPECT_TRUE(constantTimeEquals("abc", "abc"));
+    EXPECT_TRUE(constantTimeEquals("", ""));
+    EXPECT_FALSE(constantTimeEquals("abc", "abd"));
+    EXPECT_FALSE(constantTimeEquals("abc", "abcd"));
+}
+
+// ============================================================================
+// Pbkdf2PasswordHasher Tests
+// ============================================================================
+
+TEST(Pbkdf2PasswordHasherTest, VerifiesItsOwnHashes) {
+    Pbkdf2PasswordHasher hasher(1000);
+    const auto encoded = hasher.hash("Passw0rd.123");
+
+    EXPECT_THAT(encoded, StartsWith("pbkdf2-sha256$1000$"));
+    EXPECT_TRUE(hasher.verify("Passw0rd.123", encoded));
+    EXPECT_FALSE(hasher.verify("Passw0rd.124", encoded));
+}
+
+TEST(Pbkdf2PasswordHasherTest, SaltsEveryHash) {
+    Pbkdf2PasswordHasher hasher(10);
+    EXPECT_THAT(hasher.hash("same"), Not(Eq(hasher.hash("same"))));
+}
+
+TEST(Pbkdf2PasswordHasherTest, ReadsTheCostFromTheStoredHash) {
+    const auto encoded = Pbkdf2PasswordHasher(50).hash("secret");
+    EXPECT_TRUE(Pbkdf2PasswordHasher(2000).verify("secret", encoded));
+}
+
+TEST(Pbkdf2PasswordHasherTest, RejectsMalformedHashes) {
+    Pbkdf2PasswordHasher hasher(10, 1000);
+    const auto encoded = hasher.hash("secret");
+
+    EXPECT_FALSE(hasher.verify("secret", ""));
+    EXPECT_FALSE(hasher.verify("secret", "hashedpw"));
+    EXPECT_FALSE(hasher.verify("secret", "pbkdf2-sha256$10$zz$00"));
+    EXPECT_FALSE(hasher.verify("secret", "pbkdf2-sha256$abc$00$00"));
+    EXPECT_FALSE(hasher.verify("secret", "pbkdf2-sha256$0$00$00"));
+    EXPECT_FALSE(hasher.verify("secret", encoded.substr(0, encoded.size() - 1)));
+    // Above maxIterations
+    EXPECT_FALSE(hasher.verify("secret", Pbkdf2PasswordHasher(2000, 2000).hash("secret")));
+}
+
+TEST(Pbkdf2PasswordHasherTest, RejectsKeysOfAnyOtherLength) {
+    Pbkdf2PasswordHasher hasher(1000, 1000);
+    const auto encoded = hasher.hash("secret");
+    const auto prefix = encoded.substr(0, encoded.rfind('$') + 1);
+    const auto key = encoded.substr(prefix.size());
+
+    EXPECT_TRUE(hasher.verify("secret", prefix + key));
+    EXPECT_FALSE(hasher.verify("secret", prefix + key.substr(0, 32)));
+    // Would take 2048 PBKDF2 blocks of 1000 iterations each if accepted
+    EXPECT_FALSE(hasher.verify("secret", prefix + std::string(2048 * 64, 'a')));
+}
+
+TEST(Pbkdf2PasswordHasherTest, RejectsInvalidCost) {
+    EXPECT_THROW(Pbkdf2PasswordHasher(0), std::invalid_argument);
+    EXPECT_THROW(Pbkdf2PasswordHasher(100, 10), std::invalid_argument);
+}
+
+// ============================================================================
+// PooledPasswordHasher Tests
+// ============================================================================
+
+TEST(PooledPasswordHasherTest, DelegatesToTheInnerHasher) {
+    PooledPasswordHasher hasher(std::make_shared<Pbkdf2PasswordHasher>(100), 2, 4);
+    const auto encoded = hasher.hash("secret");
+
+    EXPECT_TRUE(hasher.verify("secret", encoded));
+    EXPECT_FALSE(hasher.verifyAsync("wrong", encoded).get());
+}
+
+TEST(PooledPasswordHasherTest, TryVerifyShedsLoadWhenSaturated) {
+    std::promise<void> release;
+    PooledPasswordHasher hasher(std::make_shared<GateHasher>(release.get_future().share()), 1, 1);
+
+    auto running = hasher.verifyAsync("a", "a");
+    while (hasher.queued() != 0) {
+        std::this_thread::yield();
+    }
+    auto queued = hasher.tryVerifyAsync("b", "b");
+    auto rejected = hasher.tryVerifyAsync("c", "c");
+
+    EXPECT_TRUE(queued.has_value());
+    EXPECT_FALSE(rejected.has_value());
+
+    release.set_value();
+    EXPECT_TRUE(running.get());
+    EXPECT_TRUE(queued->get());
+}
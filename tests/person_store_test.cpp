@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "person_store.h"
+#include "alloc_counter.h"
+#include <limits>
+#include <vector>
+
+using ::testing::StrEq;
+using ::testing::AllOf;
+using ::testing::Field;
+
+// ============================================================================
+// Hash Scan Tests
+// ============================================================================
+
+TEST(FindMatchingHashTest, MatchesTheScalarScanAtEveryPosition) {
+    std::vector<uint64_t> hashes(100);
+    for (size_t i = 0; i < hashes.size(); i++) {
+        hashes[i] = i * 0x9e3779b97f4a7c15ULL;
+    }
+    hashes[77] = hashes[5];
+
+    for (size_t count = 0; count <= hashes.size(); count++) {
+        for (size_t i = 0; i < hashes.size(); i += 3) {
+            for (size_t from : {size_t{0}, size_t{6}, size_t{40}}) {
+                EXPECT_EQ(findMatchingHash(hashes.data(), count, hashes[i], from),
+                          findMatchingHashScalar(hashes.data(), count, hashes[i], from))
+                    << "count " << count << ", needle " << i << ", from " << from;
+            }
+        }
+    }
+}
+
+TEST(FindMatchingHashTest, ReturnsCountWhenNothingMatches) {
+    std::vector<uint64_t> hashes(37, 1);
+
+    EXPECT_EQ(findMatchingHash(hashes.data(), hashes.size(), 2), hashes.size());
+    EXPECT_EQ(findMatchingHash(hashes.data(), hashes.size(), 1, 36), 36u);
+    EXPECT_EQ(findMatchingHash(hashes.data(), hashes.size(), 1, 37), 37u);
+}
+
+// ============================================================================
+// StringColumn Tests
+// ============================================================================
+
+TEST(StringColumnTest, TruncateDropsTheLaterValues) {
+    StringColumn column;
+    column.append("one");
+    column.append("");
+    column.append("three");
+
+    column.truncate(1);
+    column.append("two");
+
+    ASSERT_EQ(column.size(), 2u);
+    EXPECT_EQ(column[0], "one");
+    EXPECT_EQ(column[1], "two");
+}
+
+TEST(StringColumnTest, FitsUpToTheOffsetLimit) {
+    StringColumn column;
+    column.append("abc");
+
+    EXPECT_TRUE(column.fits(std::numeric_limits<uint32_t>::max() - 3));
+    EXPECT_FALSE(column.fits(std::numeric_limits<uint32_t>::max() - 2));
+    EXPECT_FALSE(column.fits(std::numeric_limits<size_t>::max()));
+}
+
+// ============================================================================
+// PersonStore Tests
+// ============================================================================
+
+static const std::vector<Person> persons = {
+    {"1", "alice@example.com", "hash-a", "active"},
+    {"2", "bob@example.com", "hash-b", "locked"},
+    {"3", "carol@example.com", "hash-c", "active"},
+};
+
+TEST(PersonStoreTest, ReturnsPersonWhenFound) {
+    PersonStore store(PersonKey::Id, persons);
+
+    auto result = store.get("2");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(*result, AllOf(
+        Field(&Person::id, StrEq("2")),
+        Field(&Person::email, StrEq("bob@example.com")),
+        Field(&Person::passwordHash, StrEq("hash-b")),
+        Field(&Person::status, StrEq("locked"))
+    ));
+}
+
+TEST(PersonStoreTest, ReturnsNulloptWhenNotFound) {
+    PersonStore store(PersonKey::Id, persons);
+
+    EXPECT_FALSE(store.get("4").has_value());
+    EXPECT_FALSE(store.findByEmail("dave@example.com").has_value());
+}
+
+TEST(PersonStoreTest, LooksUpByEmailWhenThatIsTheKey) {
+    PersonStore store(PersonKey::Email, persons);
+
+    auto result = store.get("carol@example.com");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->id, StrEq("3"));
+    EXPECT_FALSE(store.get("3").has_value());
+}
+
+TEST(PersonStoreTest, FirstPersonWithAKeyWins) {
+    PersonStore store(PersonKey::Id, persons);
+    store.add({"1", "other@example.com", "hash-x", "active"});
+
+    EXPECT_THAT(store.findById("1")->email, StrEq("alice@example.com"));
+    EXPECT_THAT(store.findByEmail("other@example.com")->id, StrEq("1"));
+}
+
+TEST(PersonStoreTest, KeepsEmptyFields) {
+    PersonStore store;
+    store.add({"", "", "", ""});
+
+    auto result = store.findById("");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->email.empty());
+    EXPECT_TRUE(result->status.empty());
+}
+
+TEST(PersonStoreTest, FindsPeopleAcrossManyAdds) {
+    PersonStore store;
+    for (int i = 0; i < 5000; i++) {
+        const auto n = std::to_string(i);
+        store.add({"id-" + n, "user" + n + "@example.com", "hash" + n, i % 2 ? "active" : "locked"});
+    }
+
+    ASSERT_EQ(store.size(), 5000u);
+    for (int i = 0; i < 5000; i += 499) {
+        const auto n = std::to_string(i);
+        auto result = store.findByEmail("user" + n + "@example.com");
+        ASSERT_TRUE(result.has_value());
+        EXPECT_THAT(result->id, StrEq("id-" + n));
+        EXPECT_THAT(result->status, StrEq(i % 2 ? "active" : "locked"));
+    }
+}
+
+TEST(PersonStoreTest, AtCopiesEachFieldOnce) {
+    PersonStore store;
+    store.add({"1", "a.rather.long.email@example.com", "a-password-hash-longer-than-sso", "active"});
+
+    const uint64_t before = allocationCount.load();
+    const Person person = store.at(0);
+    const uint64_t allocations = allocationCount.load() - before;
+
+    // Only the email and the hash are too long for the small string buffer
+    EXPECT_EQ(allocations, 2u);
+    EXPECT_THAT(person.email, StrEq("a.rather.long.email@example.com"));
+}
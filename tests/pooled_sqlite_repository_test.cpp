@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "pooled_sqlite_repository.h"
+#include "uss.h"
+#include <sqlite3.h>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using ::testing::StrEq;
+using ::testing::AllOf;
+using ::testing::Field;
+
+// ============================================================================
+// Pooled SQLite Repository Integration Tests
+// ============================================================================
+
+class PooledSqliteRepositoryTest : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() /
+                (std::string("pooled_sqlite_repository_test_") +
+                 ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".db")).string();
+        removeDbFiles();
+
+        sqlite3* db = nullptr;
+        ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK) << "Failed to open database file";
+        const char* createTableSql = R"(
+            CREATE TABLE persons (
+                id TEXT PRIMARY KEY,
+                email TEXT NOT NULL,
+                passwordHash TEXT NOT NULL,
+                status TEXT NOT NULL
+            )
+        )";
+        int result = sqlite3_exec(db, createTableSql, nullptr, nullptr, nullptr);
+        sqlite3_close(db);
+        ASSERT_EQ(result, SQLITE_OK) << "Failed to create table";
+    }
+
+    void TearDown() override {
+        removeDbFiles();
+    }
+
+    void removeDbFiles() {
+        std::remove(path.c_str());
+        std::remove((path + "-wal").c_str());
+        std::remove((path + "-shm").c_str());
+    }
+
+    // Row mapper: converts SQL row to Person
+    static Person personRowMapper(sqlite3_stmt* stmt) {
+        Person person;
+        person.id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+        person.email = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+        person.passwordHash = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+        person.status = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+        return person;
+    }
+
+    // Binder: binds Person fields to prepared statement
+    static void personBinder(sqlite3_stmt* stmt, const Person& person) {
+        sqlite3_bind_text(stmt, 1, person.id.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, person.email.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 3, person.passwordHash.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 4, person.status.c_str(), -1, SQLITE_TRANSIENT);
+    }
+};
+
+TEST_F(PooledSqliteRepositoryTest, ReturnsPersonWhenFound) {
+    PooledSqliteRepository<Person> repo(path, 4, "persons", personRowMapper, "id");
+
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+    auto result = repo.get("123");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(*result, AllOf(
+        Field(&Person::id, StrEq("123")),
+        Field(&Person::email, StrEq("alice@example.com")),
+        Field(&Person::passwordHash, StrEq("hashedpw")),
+        Field(&Person::status, StrEq("active"))
+    ));
+    EXPECT_FALSE(repo.get("nonexistent").has_value());
+}
+
+TEST_F(PooledSqliteRepositoryTest, SwitchesTheDatabaseToWalMode) {
+    PooledSqliteRepository<Person> repo(path, 2, "persons", personRowMapper, "id");
+
+    sqlite3* db = nullptr;
+    sqlite3_open(path.c_str(), &db);
+    std::string journalMode;
+    sqlite3_exec(db, "PRAGMA journal_mode", [](void* out, int, char** values, char**) {
+        *static_cast<std::string*>(out) = values[0];
+        return 0;
+    }, &journalMode, nullptr);
+    sqlite3_close(db);
+
+    EXPECT_THAT(journalMode, StrEq("wal"));
+}
+
+TEST_F(PooledSqliteRepositoryTest, ProjectionsWorkOnEveryConnection) {
+    PooledSqliteRepository<Person> repo(path, 3, "persons", personRowMapper, "email");
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+    auto authColumns = repo.prepareProjection({"id", "status"});
+
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 6; t++) {
+        threads.emplace_back([&] {
+            repo.withRow(authColumns, "alice@example.com", [&](const SqliteRowView& row) {
+                if (row.text(0) == "123" && row.text(1) == "active") {
+                    found++;
+                }
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(found.load(), 6);
+}
+
+TEST_F(PooledSqliteRepositoryTest, ConcurrentlyPreparedProjectionsSelectTheirOwnColumns) {
+    PooledSqliteRepository<Person> repo(path, 4, "persons", personRowMapper, "email");
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+    const std::vector<std::string> columns = {"id", "email", "passwordHash", "status"};
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&, t] {
+            const std::string& column = columns[t % columns.size()];
+            for (int i = 0; i < 20; i++) {
+                auto projection = repo.prepareProjection({column, "'" + std::to_string(t) + "'"});
+                // Reads go through whichever connection is free
+                for (int read = 0; read < 4; read++) {
+                    repo.withRow(projection, "alice@example.com", [&](const SqliteRowView& row) {
+                        if (row.text(1) != std::to_string(t)) {
+                            mismatches++;
+                        }
+                    });
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(PooledSqliteRepositoryTest, FailedProjectionLeavesLaterOnesIntact) {
+    PooledSqliteRepository<Person> repo(path, 3, "persons", personRowMapper, "email");
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+
+    EXPECT_THROW(repo.prepareProjection({"noSuchColumn"}), RepositoryException);
+    auto statusColumn = repo.prepareProjection({"status"});
+
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 6; t++) {
+        threads.emplace_back([&] {
+            repo.withRow(statusColumn, "alice@example.com", [&](const SqliteRowView& row) {
+                if (row.text(0) == "active") {
+                    found++;
+                }
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(found.load(), 6);
+}
+
+TEST_F(PooledSqliteRepositoryTest, HandlesConcurrentReadsAndWrites) {
+    PooledSqliteRepository<Person> repo(path, 4, "persons", personRowMapper, "id");
+    std::vector<Person> persons;
+    for (int i = 0; i < 200; i++) {
+        persons.push_back({std::to_string(i), "user" + std::to_string(i) + "@example.com", "hash", "active"});
+    }
+    repo.insertMany(persons, personBinder);
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&repo, &mismatches, t] {
+            for (int i = 0; i < 300; i++) {
+                auto id = std::to_string((i * 7 + t) % 200);
+                auto result = repo.get(id);
+                if (!result || std::string_view(result->email) != "user" + id + "@example.com") {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    threads.emplace_back([&repo] {
+        for (int i = 200; i < 250; i++) {
+            repo.insert({std::to_string(i), "late@example.com", "hash", "active"}, personBinder);
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_TRUE(repo.get("249").has_value());
+}
+
+TEST_F(PooledSqliteRepositoryTest, ThrowsWhenTheDatabaseCannotBeOpened) {
+    auto action = [] {
+        PooledSqliteRepository<Person> repo("/nonexistent-dir/db.sqlite", 2, "persons", personRowMapper, "id");
+    };
+
+    EXPECT_THROW(action(), RepositoryException);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "pooled_uuid_generator.h"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using ::testing::MatchesRegex;
+
+// ============================================================================
+// PooledUuidGenerator Tests
+// ============================================================================
+
+// Calls create() until an ID comes from the pool or the timeout elapses
+static bool waitForPoolHit(PooledUuidGenerator& generator) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto before = generator.stats().hits;
+        generator.create();
+        if (generator.stats().hits > before) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+TEST(PooledUuidGeneratorTest, CreatesIdsInTheFormatOfTheWrappedGenerator) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorV4<UuidFormatUpperDashed>>());
+
+    EXPECT_EQ(generator.length(), 36u);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_THAT(generator.create(),
+            MatchesRegex("[A-F0-9]{8}-[A-F0-9]{4}-4[A-F0-9]{3}-[89AB][A-F0-9]{3}-[A-F0-9]{12}"));
+    }
+}
+
+TEST(PooledUuidGeneratorTest, FirstCallOnAThreadIsAMiss) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>());
+
+    generator.create();
+
+    EXPECT_EQ(generator.stats().misses, 1u);
+    EXPECT_EQ(generator.stats().hits, 0u);
+}
+
+TEST(PooledUuidGeneratorTest, ServesIdsFromThePoolOnceRefilled) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>(), 64);
+
+    ASSERT_TRUE(waitForPoolHit(generator)) << "The background thread should refill the ring";
+
+    auto stats = generator.stats();
+    EXPECT_GE(stats.hits, 1u);
+    EXPECT_GE(stats.misses, 1u);
+}
+
+TEST(PooledUuidGeneratorTest, CountsEveryCallAsHitOrMiss) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>(), 16);
+
+    for (int i = 0; i < 1000; i++) {
+        generator.create();
+    }
+
+    auto stats = generator.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 1000u);
+}
+
+TEST(PooledUuidGeneratorTest, CreateIntoFillsTheBufferFromThePool) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>());
+    std::string buffer(10 * 32 + 1, '#');
+
+    generator.createInto(buffer.data(), 10);
+
+    EXPECT_THAT(buffer.substr(0, 320), MatchesRegex("[a-f0-9]{320}"));
+    EXPECT_EQ(buffer.back(), '#');
+}
+
+TEST(PooledUuidGeneratorTest, IdsAreUniqueAcrossThreads) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>(), 32);
+    std::vector<std::vector<std::string>> perThread(4);
+
+    std::vector<std::thread> threads;
+    for (auto& ids : perThread) {
+        threads.emplace_back([&generator, &ids] {
+            for (int i = 0; i < 500; i++) {
+                ids.push_back(generator.create());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<std::string> distinct;
+    for (const auto& ids : perThread) {
+        distinct.insert(ids.begin(), ids.end());
+    }
+    EXPECT_EQ(distinct.size(), 2000u);
+    auto stats = generator.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 2000u);
+}
+
+TEST(PooledUuidGeneratorTest, UnregistersTheRingWhenItsThreadExits) {
+    PooledUuidGenerator generator(std::make_shared<UuidGeneratorRandomImpl>(), 32);
+    generator.create();
+
+    for (int i = 0; i < 20; i++) {
+        std::thread([&generator] { generator.create(); }).join();
+    }
+
+    EXPECT_EQ(generator.stats().rings, 1u);
+}
+
+TEST(PooledUuidGeneratorTest, ThreadOutlivingThePoolExitsCleanly) {
+    auto generator = std::make_unique<PooledUuidGenerator>(std::make_shared<UuidGeneratorRandomImpl>(), 32);
+    std::promise<void> created;
+    std::promise<void> poolDestroyed;
+    std::thread thread([&] {
+        generator->create();
+        created.set_value();
+        poolDestroyed.get_future().wait();
+    });
+
+    created.get_future().wait();
+    generator.reset();
+    poolDestroyed.set_value();
+    thread.join();
+
+    // A new pool on this thread drops the entry of the old one
+    PooledUuidGenerator next(std::make_shared<UuidGeneratorRandomImpl>(), 32);
+    next.create();
+    EXPECT_EQ(next.stats().rings, 1u);
+}
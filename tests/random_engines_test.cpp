@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "random_engines.h"
+#include "uuid_generator.h"
+#include <memory>
+#include <set>
+#include <thread>
+
+using ::testing::ElementsAre;
+using ::testing::MatchesRegex;
+
+// ============================================================================
+// xoshiro256** Tests
+// ============================================================================
+
+TEST(Xoshiro256StarStarTest, MatchesReferenceOutputForKnownState) {
+    Xoshiro256StarStar engine(std::array<uint64_t, 4>{1, 2, 3, 4});
+
+    EXPECT_EQ(engine(), 11520u);
+    EXPECT_EQ(engine(), 0u);
+    EXPECT_EQ(engine(), 1509978240u);
+    EXPECT_EQ(engine(), 1215971899390074240u);
+}
+
+TEST(Xoshiro256StarStarTest, SameSeedGivesSameSequence) {
+    Xoshiro256StarStar a(42);
+    Xoshiro256StarStar b(42);
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(a(), b());
+    }
+}
+
+TEST(Xoshiro256StarStarTest, JumpLeavesTheOriginalSequence) {
+    Xoshiro256StarStar a(42);
+    Xoshiro256StarStar b(42);
+
+    b.jump();
+
+    std::set<uint64_t> first;
+    for (int i = 0; i < 1000; i++) {
+        first.insert(a());
+    }
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(first.count(b()), 0u);
+    }
+}
+
+// ============================================================================
+// Philox4x32-10 Tests
+// ============================================================================
+
+TEST(Philox4x32x10Test, MatchesRandom123KnownAnswers) {
+    EXPECT_THAT(Philox4x32x10::block({0, 0, 0, 0}, {0, 0}),
+                ElementsAre(0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u));
+    EXPECT_THAT(Philox4x32x10::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+                ElementsAre(0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu));
+    EXPECT_THAT(Philox4x32x10::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+                ElementsAre(0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u));
+}
+
+TEST(Philox4x32x10Test, DiscardJumpsToTheSameValueAsDrawing) {
+    for (unsigned long long skip : {0ull, 1ull, 2ull, 3ull, 1000ull, 1001ull}) {
+        Philox4x32x10 drawn(7, 3);
+        Philox4x32x10 skipped(7, 3);
+        drawn();
+        skipped();
+
+        for (unsigned long long i = 0; i < skip; i++) {
+            drawn();
+        }
+        skipped.discard(skip);
+
+        EXPECT_EQ(drawn(), skipped()) << "after skipping " << skip;
+        EXPECT_EQ(drawn(), skipped()) << "after skipping " << skip;
+    }
+}
+
+TEST(Philox4x32x10Test, StreamsWithTheSameKeyDiffer) {
+    Philox4x32x10 a(7, 0);
+    Philox4x32x10 b(7, 1);
+
+    EXPECT_NE(a(), b());
+}
+
+// ============================================================================
+// Engine selection for the UUID generators
+// ============================================================================
+
+TEST(RandomEngineTest, FillRandomWordsCombinesNarrowEngines) {
+    std::mt19937 engine(1);
+    std::mt19937 reference(1);
+    uint64_t word;
+
+    fillRandomWords(engine, &word, 1);
+
+    const uint64_t high = reference();
+    EXPECT_EQ(word, (high << 32) | reference());
+}
+
+TEST(RandomEngineTest, UuidGeneratorsAcceptEveryEngine) {
+    const std::string v4 = "[a-f0-9]{12}4[a-f0-9]{3}[89ab][a-f0-9]{15}";
+
+    EXPECT_THAT((UuidGeneratorV4<UuidFormatLower, std::mt19937>().create()), MatchesRegex(v4));
+    EXPECT_THAT((UuidGeneratorV4<UuidFormatLower, Xoshiro256StarStar>().create()), MatchesRegex(v4));
+    EXPECT_THAT((UuidGeneratorV4<UuidFormatLower, Philox4x32x10>().create()), MatchesRegex(v4));
+    EXPECT_THAT((UuidGeneratorV7<UuidFormatLower, Philox4x32x10>().create()), MatchesRegex("[a-f0-9]{32}"));
+}
+
+TEST(RandomEngineTest, PhiloxThreadEnginesProduceDistinctIds) {
+    UuidGeneratorV4<UuidFormatLower, Philox4x32x10> generator;
+    std::vector<std::string> a, b;
+
+    std::thread first([&] { a = generator.createBatch(500); });
+    std::thread second([&] { b = generator.createBatch(500); });
+    first.join();
+    second.join();
+
+    std::set<std::string> distinct(a.begin(), a.end());
+    distinct.insert(b.begin(), b.end());
+    EXPECT_EQ(distinct.size(), 1000u);
+}
@@ -43,4 +43,128 @@ TEST(VectorRepositoryTest, ReturnsNulloptWhenNotFound) {
 
     auto result = repo.get("999");
     EXPECT_FALSE(result.has_value());
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// IndexedVectorRepository Tests
+// ============================================================================
+
+static const auto isbnOf = [](const Book& book) {
+        return book.isbn;
+};
+
+TEST(IndexedVectorRepositoryTest, ReturnsItemWhenFound) {
+    IndexedVectorRepository<Book> repo(isbnOf, initialData);
+
+    auto result = repo.get(existingIsbn);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(*result, AllOf(
+        Field(&Book::isbn, StrEq(existingIsbn)),
+        Field(&Book::title, StrEq("Necronomicon"))
+    ));
+}
+
+TEST(IndexedVectorRepositoryTest, ReturnsNulloptWhenNotFound) {
+    IndexedVectorRepository<Book> repo(isbnOf, initialData);
+
+    auto result = repo.get("999");
+    EXPECT_FALSE(result.has_value());
+}
+
+TEST(IndexedVectorRepositoryTest, FindsItemsAddedLater) {
+    IndexedVectorRepository<Book> repo(isbnOf);
+
+    repo.add({"42", "The Hitchhiker's Guide"});
+
+    auto result = repo.get("42");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->title, StrEq("The Hitchhiker's Guide"));
+}
+
+TEST(IndexedVectorRepositoryTest, ReturnsFirstItemForDuplicateKeys) {
+    IndexedVectorRepository<Book> repo(isbnOf, initialData);
+
+    repo.add({existingIsbn, "Duplicate"});
+
+    auto result = repo.get(existingIsbn);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->title, StrEq("Necronomicon"));
+}
+
+TEST(IndexedVectorRepositoryTest, FindsEveryItemAfterGrowing) {
+    IndexedVectorRepository<Book> repo(isbnOf);
+    for (int i = 0; i < 10000; i++) {
+        repo.add({std::to_string(i), "Title " + std::to_string(i)});
+    }
+
+    for (int i = 0; i < 10000; i++) {
+        auto result = repo.get(std::to_string(i));
+        ASSERT_TRUE(result.has_value()) << "isbn " << i;
+        ASSERT_THAT(result->title, StrEq("Title " + std::to_string(i)));
+    }
+    EXPECT_FALSE(repo.get("10000").has_value());
+}
+
+TEST(IndexedVectorRepositoryTest, ThrowingKeyExtractorLeavesTheRepositoryUnchanged) {
+    IndexedVectorRepository<Book> repo([](const Book& book) {
+        if (book.isbn.empty()) {
+            throw std::invalid_argument("no isbn");
+        }
+        return book.isbn;
+    });
+    repo.add({"1", "One"});
+
+    EXPECT_THROW(repo.add({"", "Unknown"}), std::invalid_argument);
+    for (int i = 2; i < 100; i++) {
+        repo.add({std::to_string(i), "Title " + std::to_string(i)});
+    }
+
+    for (int i = 2; i < 100; i++) {
+        auto result = repo.get(std::to_string(i));
+        ASSERT_TRUE(result.has_value()) << "isbn " << i;
+        ASSERT_THAT(result->title, StrEq("Title " + std::to_string(i)));
+    }
+    EXPECT_THAT(repo.get("1")->title, StrEq("One"));
+    EXPECT_FALSE(repo.get("").has_value());
+}
+
+
+// ============================================================================
+// getMany Tests
+// ============================================================================
+
+TEST(VectorRepositoryTest, GetManyReturnsResultsInTheOrderOfTheIds) {
+    VectorRepository<Book> repo(filterByIsbn, {
+        {"1", "One"},
+        {"2", "Two"},
+        {"3", "Three"},
+    });
+
+    auto results = repo.getMany({"3", "999", "1", "3"});
+
+    ASSERT_EQ(results.size(), 4u);
+    ASSERT_TRUE(results[0].has_value());
+    EXPECT_THAT(results[0]->title, StrEq("Three"));
+    EXPECT_FALSE(results[1].has_value());
+    ASSERT_TRUE(results[2].has_value());
+    EXPECT_THAT(results[2]->title, StrEq("One"));
+    ASSERT_TRUE(results[3].has_value());
+    EXPECT_THAT(results[3]->title, StrEq("Three"));
+}
+
+TEST(IndexedVectorRepositoryTest, GetManyDefaultsToGetPerId) {
+    IndexedVectorRepository<Book> repo(isbnOf, initialData);
+
+    auto results = repo.getMany({"999", existingIsbn});
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_FALSE(results[0].has_value());
+    ASSERT_TRUE(results[1].has_value());
+    EXPECT_THAT(results[1]->title, StrEq("Necronomicon"));
+}
+
+TEST(ThrowingRepositoryTest, GetManyPropagatesTheException) {
+    ThrowingRepository<Book> repo;
+
+    EXPECT_THROW(repo.getMany({existingIsbn}), RepositoryException);
+}
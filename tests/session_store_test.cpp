@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "session_store.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ::testing::StrEq;
+using ::testing::ElementsAre;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Clock that only moves when the test advances it
+struct ManualClock {
+    std::shared_ptr<std::chrono::steady_clock::time_point> now =
+        std::make_shared<std::chrono::steady_clock::time_point>();
+
+    SessionStore::Clock clock() const {
+        auto time = now;
+        return [time] { return *time; };
+    }
+
+    void advance(std::chrono::milliseconds by) {
+        *now += by;
+    }
+};
+
+Session session(const std::string& id, const std::string& userId = "user") {
+    return {userId, id};
+}
+
+std::vector<uint64_t> expireUpTo(TimingWheel& wheel, uint64_t now) {
+    std::vector<uint64_t> expired;
+    wheel.advance(now, [&expired](const TimingWheel::Timer& timer) { expired.push_back(timer.deadline); });
+    return expired;
+}
+
+}
+
+// ============================================================================
+// Timing Wheel Tests
+// ============================================================================
+
+TEST(TimingWheelTest, FiresEachTimerAtItsDeadlineAcrossAllLevels) {
+    TimingWheel wheel;
+    std::mt19937_64 random(7);
+    std::multiset<uint64_t> deadlines;
+    for (int i = 0; i < 2000; i++) {
+        // Up to 64^3 ticks ahead, so some cascade twice
+        const uint64_t deadline = random() % 300000;
+        deadlines.insert(deadline);
+        wheel.schedule("k" + std::to_string(i), deadline);
+    }
+
+    uint64_t now = 0;
+    while (!deadlines.empty()) {
+        now += 1 + random() % 500;
+        for (uint64_t deadline : expireUpTo(wheel, now)) {
+            ASSERT_LE(deadline, now);
+            ASSERT_GT(deadlines.count(deadline), 0u) << deadline;
+            deadlines.erase(deadlines.find(deadline));
+        }
+        if (!deadlines.empty()) {
+            ASSERT_GT(*deadlines.begin(), now) << "missed";
+        }
+    }
+    EXPECT_EQ(wheel.scheduled(), 0u);
+}
+
+TEST(TimingWheelTest, ClampsDeadlinesBeyondTheHorizon) {
+    TimingWheel wheel;
+    const uint64_t far = (uint64_t{1} << 24) + 100;
+    wheel.schedule("far", far);
+
+    EXPECT_TRUE(expireUpTo(wheel, far - 1).empty());
+    EXPECT_THAT(expireUpTo(wheel, far), ElementsAre(far));
+}
+
+TEST(TimingWheelTest, PopFirstReturnsTheEarliestAcceptedTimer) {
+    TimingWheel wheel(10);
+    wheel.schedule("late", 5000);
+    wheel.schedule("soon", 20);
+    wheel.schedule("skipped", 15);
+    wheel.schedule("mid", 300);
+
+    auto first = wheel.popFirst([](const TimingWheel::Timer& timer) { return timer.key != "skipped"; });
+
+    ASSERT_TRUE(first.has_value());
+    EXPECT_THAT(first->key, StrEq("soon"));
+    EXPECT_EQ(wheel.scheduled(), 2u);
+}
+
+TEST(TimingWheelTest, CompactDropsTheRejectedTimers) {
+    TimingWheel wheel;
+    for (uint64_t deadline : {1, 2, 100, 5000, 300000}) {
+        wheel.schedule("keep", deadline);
+        wheel.schedule("drop", deadline);
+    }
+
+    wheel.compact([](const TimingWheel::Timer& timer) { return timer.key == "keep"; });
+
+    EXPECT_EQ(wheel.scheduled(), 5u);
+    EXPECT_THAT(expireUpTo(wheel, 300000), ElementsAre(1, 2, 100, 5000, 300000));
+}
+
+// ============================================================================
+// Session Store Tests
+// ============================================================================
+
+class SessionStoreTest : public ::testing::Test {
+protected:
+    ManualClock time;
+
+    SessionStore makeStore(size_t maxSessions = 1000, size_t shardCount = 4) {
+        return SessionStore({maxSessions, shardCount, 60s, 1s}, time.clock());
+    }
+};
+
+TEST_F(SessionStoreTest, ReturnsStoredSessions) {
+    auto store = makeStore();
+    store.put(session("s1", "alice"));
+
+    auto found = store.get("s1");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_THAT(found->userId, StrEq("alice"));
+    EXPECT_THAT(found->sessionId, StrEq("s1"));
+    EXPECT_FALSE(store.get("s2").has_value());
+}
+
+TEST_F(SessionStoreTest, SessionsExpireAfterTheTtl) {
+    auto store = makeStore();
+    store.put(session("s1"));
+
+    time.advance(59s);
+    EXPECT_TRUE(store.contains("s1"));
+    time.advance(1s);
+    EXPECT_FALSE(store.contains("s1"));
+    EXPECT_EQ(store.size(), 1u);
+
+    store.expire();
+    EXPECT_EQ(store.size(), 0u);
+}
+
+TEST_F(SessionStoreTest, PutRestartsTheTtl) {
+    auto store = makeStore();
+    store.put(session("s1"));
+    time.advance(30s);
+    store.put(session("s1", "renewed"));
+    time.advance(45s);
+    store.expire();
+
+    auto found = store.get("s1");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_THAT(found->userId, StrEq("renewed"));
+}
+
+TEST_F(SessionStoreTest, RemoveDropsTheSession) {
+    auto store = makeStore();
+    store.put(session("s1"));
+
+    EXPECT_TRUE(store.remove("s1"));
+    EXPECT_FALSE(store.remove("s1"));
+    EXPECT_FALSE(store.contains("s1"));
+
+    // The stale timer must not touch a session added later under the same ID
+    time.advance(30s);
+    store.put(session("s1"));
+    time.advance(31s);
+    store.expire();
+    EXPECT_TRUE(store.contains("s1"));
+}
+
+TEST_F(SessionStoreTest, FullShardEvictsTheSessionClosestToExpiry) {
+    auto store = makeStore(3, 1);
+    store.put(session("oldest"));
+    time.advance(1s);
+    store.put(session("middle"));
+    time.advance(1s);
+    store.put(session("newest"));
+    time.advance(1s);
+    store.put(session("extra"));
+
+    EXPECT_EQ(store.size(), 3u);
+    EXPECT_FALSE(store.contains("oldest"));
+    EXPECT_TRUE(store.contains("middle"));
+    EXPECT_TRUE(store.contains("extra"));
+}
+
+TEST_F(SessionStoreTest, NeverHoldsMoreThanItsCapacity) {
+    auto store = makeStore(64, 4);
+    for (int i = 0; i < 1000; i++) {
+        store.put(session("s" + std::to_string(i)));
+        if (i % 10 == 0) {
+            time.advance(1s);
+        }
+    }
+    EXPECT_LE(store.size(), store.capacity());
+    EXPECT_TRUE(store.contains("s999"));
+}
+
+TEST_F(SessionStoreTest, RefreshingASessionKeepsTheWheelBounded) {
+    auto store = makeStore(1000, 1);
+    for (int i = 0; i < 10000; i++) {
+        store.put(session("s1"));
+        time.advance(1s);
+        ASSERT_LE(store.scheduled(), 2 + SessionStore::compactionSlack + 1) << "refresh " << i;
+    }
+    EXPECT_EQ(store.size(), 1u);
+
+    // The surviving timer still expires the session
+    time.advance(60s);
+    store.expire();
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_EQ(store.scheduled(), 0u);
+}
+
+TEST_F(SessionStoreTest, RemovingAndAddingKeepsTheWheelBounded) {
+    auto store = makeStore(1000, 1);
+    for (int i = 0; i < 10000; i++) {
+        store.put(session("s1"));
+        store.remove("s1");
+        if (i % 7 == 0) {
+            time.advance(1s);
+        }
+    }
+    store.put(session("s1"));
+    EXPECT_LE(store.scheduled(), 2 + SessionStore::compactionSlack + 1);
+    EXPECT_TRUE(store.contains("s1"));
+}
+
+TEST_F(SessionStoreTest, RejectsInvalidOptions) {
+    EXPECT_THROW(SessionStore({0, 4, 60s, 1s}), std::invalid_argument);
+    EXPECT_THROW(SessionStore({10, 0, 60s, 1s}), std::invalid_argument);
+    EXPECT_THROW(SessionStore({10, 4, 60s, 0s}), std::invalid_argument);
+}
+
+TEST(SessionStoreConcurrencyTest, ConcurrentReadersAndWritersAgree) {
+    SessionStore store({100000, 16, 60s, 1s});
+    for (int i = 0; i < 1000; i++) {
+        store.put(session("s" + std::to_string(i), "u" + std::to_string(i)));
+    }
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&store, &mismatches, t] {
+            for (int i = 0; i < 5000; i++) {
+                const int n = (i * 7 + t) % 1000;
+                if (t == 0) {
+                    store.put(session("w" + std::to_string(i)));
+                }
+                auto found = store.get("s" + std::to_string(n));
+                if (!found || found->userId != "u" + std::to_string(n)) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(store.size(), 6000u);
+}
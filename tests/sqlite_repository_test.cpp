@@ -3,6 +3,8 @@
 #include "repository.h"
 #include "uss.h"
 #include <sqlite3.h>
+#include <atomic>
+#include <thread>
 
 using ::testing::StrEq;
 using ::testing::AllOf;
@@ -215,3 +217,312 @@ TEST_F(SqliteRepositoryTest, HandlesSpecialCharactersInData) {
     EXPECT_THAT(result->email, StrEq("user+tag@example.com"));
     EXPECT_THAT(result->passwordHash, StrEq("hash$with$special"));
 }
+
+TEST_F(SqliteRepositoryTest, ReusesStatementsAfterAFailedInsert) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+
+    Person alice{"1", "alice@example.com", "hash1", "active"};
+    Person bob{"2", "bob@example.com", "hash2", "active"};
+    repo.insert(alice, personBinder);
+
+    // Duplicate primary key
+    EXPECT_THROW(repo.insert(alice, personBinder), std::runtime_error);
+
+    repo.insert(bob, personBinder);
+    auto result = repo.get("2");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->email, StrEq("bob@example.com"));
+}
+
+TEST_F(SqliteRepositoryTest, HandlesConcurrentLookups) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    for (int i = 0; i < 100; i++) {
+        repo.insert({std::to_string(i), "user" + std::to_string(i) + "@example.com", "hash", "active"}, personBinder);
+    }
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&repo, &mismatches, t] {
+            for (int i = 0; i < 500; i++) {
+                auto id = std::to_string((i * 7 + t) % 100);
+                auto result = repo.get(id);
+                if (!result || std::string_view(result->email) != "user" + id + "@example.com") {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(SqliteRepositoryTest, InsertManyInsertsAllRowsInBatches) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    std::vector<Person> persons;
+    for (int i = 0; i < 2500; i++) {
+        persons.push_back({std::to_string(i), "user" + std::to_string(i) + "@example.com", "hash", "active"});
+    }
+
+    auto result = repo.insertMany(persons, personBinder, 1000);
+
+    EXPECT_EQ(result.rows, 2500u);
+    EXPECT_GT(result.rowsPerSecond(), 0.0);
+    ASSERT_TRUE(repo.get("0").has_value());
+    ASSERT_TRUE(repo.get("2499").has_value());
+    EXPECT_THAT(repo.get("1234")->email, StrEq("user1234@example.com"));
+    EXPECT_TRUE(sqlite3_get_autocommit(db)) << "No transaction should be left open";
+}
+
+TEST_F(SqliteRepositoryTest, InsertManyRollsBackOnlyTheFailingBatch) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    std::vector<Person> persons = {
+        {"1", "a@example.com", "hash", "active"},
+        {"2", "b@example.com", "hash", "active"},
+        {"3", "c@example.com", "hash", "active"},
+        {"1", "duplicate@example.com", "hash", "active"},
+        {"5", "e@example.com", "hash", "active"},
+    };
+
+    EXPECT_THROW(repo.insertMany(persons, personBinder, 2), std::runtime_error);
+
+    EXPECT_TRUE(repo.get("1").has_value());
+    EXPECT_TRUE(repo.get("2").has_value());
+    EXPECT_FALSE(repo.get("3").has_value()) << "The failing batch should be rolled back";
+    EXPECT_FALSE(repo.get("5").has_value());
+    EXPECT_TRUE(sqlite3_get_autocommit(db)) << "No transaction should be left open";
+}
+
+TEST_F(SqliteRepositoryTest, InsertManyWorksInsideACallersTransaction) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    std::vector<Person> persons = {
+        {"1", "a@example.com", "hash", "active"},
+        {"2", "b@example.com", "hash", "active"},
+    };
+
+    sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+    repo.insertMany(persons, personBinder, 1);
+    sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+
+    EXPECT_FALSE(repo.get("1").has_value()) << "The caller's rollback should undo the rows";
+}
+
+TEST_F(SqliteRepositoryTest, GetManyReturnsResultsInTheOrderOfTheIds) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    repo.insert({"1", "alice@example.com", "hash1", "active"}, personBinder);
+    repo.insert({"2", "bob@example.com", "hash2", "inactive"}, personBinder);
+
+    auto results = repo.getMany({"2", "nonexistent", "1", "2"});
+
+    ASSERT_EQ(results.size(), 4u);
+    ASSERT_TRUE(results[0].has_value());
+    EXPECT_THAT(*results[0], AllOf(
+        Field(&Person::id, StrEq("2")),
+        Field(&Person::email, StrEq("bob@example.com")),
+        Field(&Person::passwordHash, StrEq("hash2")),
+        Field(&Person::status, StrEq("inactive"))
+    ));
+    EXPECT_FALSE(results[1].has_value());
+    ASSERT_TRUE(results[2].has_value());
+    EXPECT_THAT(results[2]->email, StrEq("alice@example.com"));
+    ASSERT_TRUE(results[3].has_value());
+    EXPECT_THAT(results[3]->email, StrEq("bob@example.com"));
+}
+
+TEST_F(SqliteRepositoryTest, GetManyHandlesBatchesLargerThanOneChunk) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "email"
+    );
+    std::vector<Person> persons;
+    std::vector<std::string> emails;
+    for (int i = 0; i < 2000; i++) {
+        persons.push_back({std::to_string(i), "user" + std::to_string(i) + "@example.com", "hash", "active"});
+        emails.push_back("user" + std::to_string(1999 - i) + "@example.com");
+    }
+    emails.push_back("unknown@example.com");
+    repo.insertMany(persons, personBinder);
+
+    auto results = repo.getMany(emails);
+
+    ASSERT_EQ(results.size(), 2001u);
+    for (int i = 0; i < 2000; i++) {
+        ASSERT_TRUE(results[i].has_value()) << "at index " << i;
+        ASSERT_THAT(results[i]->id, StrEq(std::to_string(1999 - i)));
+    }
+    EXPECT_FALSE(results[2000].has_value());
+}
+
+TEST_F(SqliteRepositoryTest, GetManyOfNoIdsReturnsNothing) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+
+    EXPECT_TRUE(repo.getMany({}).empty());
+}
+
+TEST_F(SqliteRepositoryTest, GetManyThrowsOnInvalidTable) {
+    SqliteRepository<Person> repo(
+        db,
+        "nonexistent_table",
+        personRowMapper,
+        "id"
+    );
+
+    EXPECT_THROW(repo.getMany({"123"}), RepositoryException);
+}
+
+TEST_F(SqliteRepositoryTest, WithRowPassesAViewOfTheRowToTheCallback) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "email"
+    );
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+
+    std::string id, status;
+    bool found = repo.withRow("alice@example.com", [&](const SqliteRowView& row) {
+        ASSERT_EQ(row.columnCount(), 4);
+        id = std::string(row.text(0));
+        status = std::string(row.text(3));
+    });
+
+    EXPECT_TRUE(found);
+    EXPECT_THAT(id, StrEq("123"));
+    EXPECT_THAT(status, StrEq("active"));
+}
+
+TEST_F(SqliteRepositoryTest, WithRowReturnsFalseWithoutCallingBackWhenNotFound) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+
+    bool called = false;
+    bool found = repo.withRow("nonexistent", [&](const SqliteRowView&) { called = true; });
+
+    EXPECT_FALSE(found);
+    EXPECT_FALSE(called);
+}
+
+TEST_F(SqliteRepositoryTest, WithRowReadsOnlyTheProjectedColumns) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "email"
+    );
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+    auto authColumns = repo.prepareProjection({"id", "passwordHash", "status"});
+
+    std::string id, passwordHash, status;
+    bool found = repo.withRow(authColumns, "alice@example.com", [&](const SqliteRowView& row) {
+        ASSERT_EQ(row.columnCount(), 3);
+        id = std::string(row.text(0));
+        passwordHash = std::string(row.text(1));
+        status = std::string(row.text(2));
+    });
+
+    EXPECT_TRUE(found);
+    EXPECT_THAT(id, StrEq("123"));
+    EXPECT_THAT(passwordHash, StrEq("hashedpw"));
+    EXPECT_THAT(status, StrEq("active"));
+}
+
+TEST_F(SqliteRepositoryTest, PrepareProjectionThrowsOnUnknownColumn) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+
+    EXPECT_THROW(repo.prepareProjection({"nonexistent"}), RepositoryException);
+}
+
+TEST_F(SqliteRepositoryTest, WithRowPropagatesCallbackExceptionsAndStaysUsable) {
+    SqliteRepository<Person> repo(
+        db,
+        "persons",
+        personRowMapper,
+        "id"
+    );
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+
+    auto action = [&repo] {
+        repo.withRow("123", [](const SqliteRowView&) { throw std::logic_error("callback failed"); });
+    };
+    EXPECT_THROW(action(), std::logic_error);
+
+    auto result = repo.get("123");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->email, StrEq("alice@example.com"));
+}
+
+TEST_F(SqliteRepositoryTest, ReleaseLetsTheConnectionClose) {
+    SqliteRepository<Person> repo(db, "persons", personRowMapper, "email");
+    repo.insert({"123", "alice@example.com", "hashedpw", "active"}, personBinder);
+    auto authColumns = repo.prepareProjection({"id"});
+    ASSERT_TRUE(repo.get("alice@example.com").has_value());
+    repo.getMany({"alice@example.com"});
+
+    repo.release();
+    ASSERT_TRUE(repo.get("alice@example.com").has_value());
+    EXPECT_TRUE(repo.withRow(authColumns, "alice@example.com", [](const SqliteRowView&) {}));
+
+    repo.release();
+    EXPECT_EQ(sqlite3_close(db), SQLITE_OK);
+    db = nullptr;
+}
+
+TEST_F(SqliteRepositoryTest, WithRowThrowsOnInvalidTable) {
+    SqliteRepository<Person> repo(
+        db,
+        "nonexistent_table",
+        personRowMapper,
+        "id"
+    );
+
+    EXPECT_THROW(repo.withRow("123", [](const SqliteRowView&) {}), RepositoryException);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "thread_pool.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// ============================================================================
+// ThreadPool Tests
+// ============================================================================
+
+TEST(ThreadPoolTest, ReturnsTaskResultsThroughFutures) {
+    ThreadPool pool(4, 16);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; i++) {
+        results.push_back(pool.submit([i] { return i * i; }));
+    }
+
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+}
+
+TEST(ThreadPoolTest, StoresExceptionsInTheFuture) {
+    ThreadPool pool(1, 1);
+
+    auto result = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, TrySubmitFailsWhenTheQueueIsFull) {
+    ThreadPool pool(1, 1);
+    std::mutex mutex;
+    std::condition_variable released;
+    bool release = false;
+    std::atomic<bool> started{false};
+
+    auto blocker = pool.submit([&] {
+        started = true;
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait(lock, [&] { return release; });
+    });
+    while (!started) {
+        std::this_thread::yield();
+    }
+    auto queued = pool.trySubmit([] { return 1; });
+    auto rejected = pool.trySubmit([] { return 2; });
+
+    EXPECT_TRUE(queued.has_value());
+    EXPECT_FALSE(rejected.has_value());
+    EXPECT_EQ(pool.queued(), 1u);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    released.notify_all();
+    blocker.get();
+    EXPECT_EQ(queued->get(), 1);
+}
+
+TEST(ThreadPoolTest, RunsQueuedTasksBeforeShuttingDown) {
+    std::atomic<int> completed{0};
+    {
+        ThreadPool pool(2, 64);
+        for (int i = 0; i < 50; i++) {
+            pool.submit([&completed] { completed++; });
+        }
+    }
+
+    EXPECT_EQ(completed.load(), 50);
+}
+
+TEST(ThreadPoolTest, RejectsZeroThreads) {
+    EXPECT_THROW(ThreadPool(0, 1), std::invalid_argument);
+}
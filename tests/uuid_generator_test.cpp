@@ -3,6 +3,8 @@
 #include "uuid_generator.h"
 #include <regex>
 #include <memory>
+#include <set>
+#include <stdexcept>
 
 using ::testing::MatchesRegex;
 
@@ -37,22 +39,42 @@ INSTANTIATE_TEST_SUITE_P(
             std::make_shared<UuidGeneratorNaiveRandomImpl>(),
             "[a-f0-9]{32}",
             "lower case, no dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorRandomImpl>(),
+            "[a-f0-9]{32}",
+            "random impl, lower case, no dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorV4<UuidFormatUpper>>(),
+            "[A-F0-9]{32}",
+            "upper case, no dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorV4<UuidFormatLowerDashed>>(),
+            "[a-f0-9]{8}-[a-f0-9]{4}-[a-f0-9]{4}-[a-f0-9]{4}-[a-f0-9]{12}",
+            "lower case, with dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorV4<UuidFormatUpperDashed>>(),
+            "[A-F0-9]{8}-[A-F0-9]{4}-[A-F0-9]{4}-[A-F0-9]{4}-[A-F0-9]{12}",
+            "upper case, with dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorV4<>>(),
+            "[a-f0-9]{12}4[a-f0-9]{3}[89ab][a-f0-9]{15}",
+            "v4, lower case, no dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorSecureV4<UuidFormatLowerDashed>>(),
+            "[a-f0-9]{8}-[a-f0-9]{4}-4[a-f0-9]{3}-[89ab][a-f0-9]{3}-[a-f0-9]{12}",
+            "secure v4, lower case, with dashes"
+        },
+        UuidGeneratorTestCase{
+            std::make_shared<UuidGeneratorV7<UuidFormatLowerDashed>>(),
+            "[a-f0-9]{8}-[a-f0-9]{4}-7[a-f0-9]{3}-[89ab][a-f0-9]{3}-[a-f0-9]{12}",
+            "v7, lower case, with dashes"
         }
-        // UuidGeneratorTestCase{
-        //     ???,
-        //     "[A-F0-9]{32}",
-        //     "upper case, no dashes"
-        // },
-        // UuidGeneratorTestCase{
-        //     ???,
-        //     "[a-f0-9]{8}-[a-f0-9]{4}-[a-f0-9]{4}-[a-f0-9]{4}-[a-f0-9]{12}",
-        //     "lower case, with dashes"
-        // },
-        // UuidGeneratorTestCase{
-        //     ???,
-        //     "[A-F0-9]{8}-[A-F0-9]{4}-[A-F0-9]{4}-[A-F0-9]{4}-[A-F0-9]{12}",
-        //     "upper case, with dashes"
-        // }
     ),
     [](const ::testing::TestParamInfo<UuidGeneratorTestCase>& info) {
         // Create test name from description
@@ -93,3 +115,101 @@ TEST(UuidGeneratorTest, CreateGeneratesOnlyHexCharacters) {
     EXPECT_THAT(uuid, MatchesRegex("^[a-f0-9]+$"))
         << "UUID should contain only lowercase hex characters";
 }
+
+// ============================================================================
+// Batch API tests
+// ============================================================================
+
+TEST(UuidGeneratorTest, CreateBatchGeneratesRequestedNumberOfDistinctIds) {
+    UuidGeneratorRandomImpl generator;
+
+    auto ids = generator.createBatch(100);
+
+    ASSERT_EQ(ids.size(), 100u);
+    std::set<std::string> distinct(ids.begin(), ids.end());
+    EXPECT_EQ(distinct.size(), 100u) << "UUIDs in a batch should be different";
+    for (const auto& id : ids) {
+        EXPECT_THAT(id, MatchesRegex("[a-f0-9]{32}"));
+    }
+}
+
+TEST(UuidGeneratorTest, CreateIntoWritesContiguousIdsWithoutOverrun) {
+    UuidGeneratorRandomImpl generator;
+    std::string buffer(3 * 32 + 1, '#');
+
+    generator.createInto(buffer.data(), 3);
+
+    EXPECT_THAT(buffer.substr(0, 96), MatchesRegex("[a-f0-9]{96}"));
+    EXPECT_EQ(buffer.back(), '#') << "createInto must not write past n * length()";
+}
+
+TEST(UuidGeneratorTest, SecureCreateIntoFillsBatchesAcrossSystemCalls) {
+    UuidGeneratorSecureV4<> generator;
+    std::string buffer(37 * 32 + 1, '#');
+
+    generator.createInto(buffer.data(), 37);
+
+    std::set<std::string> distinct;
+    for (size_t i = 0; i < 37; i++) {
+        const std::string id = buffer.substr(i * 32, 32);
+        EXPECT_THAT(id, MatchesRegex("[a-f0-9]{12}4[a-f0-9]{3}[89ab][a-f0-9]{15}"));
+        distinct.insert(id);
+    }
+    EXPECT_EQ(distinct.size(), 37u);
+    EXPECT_EQ(buffer.back(), '#') << "createInto must not write past n * length()";
+}
+
+TEST(UuidGeneratorTest, DefaultCreateBatchFallsBackToCreate) {
+    UuidGeneratorNaiveRandomImpl generator;
+
+    auto ids = generator.createBatch(5);
+
+    ASSERT_EQ(ids.size(), 5u);
+    for (const auto& id : ids) {
+        EXPECT_THAT(id, MatchesRegex("[a-f0-9]{32}"));
+    }
+}
+
+TEST(UuidGeneratorTest, DefaultCreateIntoRejectsIdsOfTheWrongLength) {
+    struct ShortIdGenerator : UuidGenerator {
+        std::string create() override { return "abc"; }
+    } generator;
+    std::string buffer(2 * 32, '#');
+
+    EXPECT_THROW(generator.createInto(buffer.data(), 2), std::length_error);
+    EXPECT_THROW(generator.createBatch(1), std::length_error);
+    EXPECT_EQ(buffer, std::string(2 * 32, '#'));
+}
+
+// ============================================================================
+// Version 7 tests
+// ============================================================================
+
+TEST(UuidGeneratorV7Test, EmbedsMillisecondTimestampInFirst48Bits) {
+    UuidGeneratorV7<> generator([] { return uint64_t{0x0123456789ab}; });
+
+    auto uuid = generator.create();
+
+    EXPECT_EQ(uuid.substr(0, 12), "0123456789ab");
+}
+
+TEST(UuidGeneratorV7Test, IdsAreStrictlyIncreasingWithinTheSameMillisecond) {
+    UuidGeneratorV7<UuidFormatLowerDashed> generator([] { return uint64_t{1700000000000}; });
+
+    auto ids = generator.createBatch(5000);
+
+    for (size_t i = 1; i < ids.size(); i++) {
+        ASSERT_LT(ids[i - 1], ids[i]) << "at index " << i;
+    }
+}
+
+TEST(UuidGeneratorV7Test, IdsStayOrderedWhenTheClockGoesBackwards) {
+    uint64_t now = 1700000000000;
+    UuidGeneratorV7<> generator([&now] { return now; });
+
+    auto first = generator.create();
+    now -= 1000;
+    auto second = generator.create();
+
+    EXPECT_LT(first, second);
+}